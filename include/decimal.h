@@ -72,6 +72,9 @@ int decimal_actual_fraction(const decimal_t *from);
 int decimal2bin(const decimal_t *from, uchar *to, int precision, int scale);
 int bin2decimal(const uchar *from, decimal_t *to, int precision, int scale,
                 bool keep_prec = false);
+int bin2scaled_longlong(const uchar *from, longlong *to, int precision,
+                        int scale);
+int scaled_longlong2decimal(longlong from, int scale, decimal_t *to);
 
 /**
   Convert decimal to lldiv_t.
@@ -149,6 +152,11 @@ static inline int decimal_string_size(const decimal_t *dec) {
 #define E_DEC_FATAL_ERROR 30
 
 static constexpr int DECIMAL_MAX_SCALE{30};
+/**
+  The highest precision of a DECIMAL whose values, with the decimal point
+  removed, always fit in a longlong.
+*/
+static constexpr int DECIMAL_LONGLONG_PRECISION{18};
 static constexpr int DECIMAL_NOT_SPECIFIED{DECIMAL_MAX_SCALE + 1};
 
 #endif  // MYSQL_ABI_CHECK
@@ -461,6 +461,8 @@ struct IO_CACHE /* Used when cacheing files */
   // Delay in milliseconds after disk synchronization of the flushed buffer.
   // Requires disk_sync = true.
   uint disk_sync_delay{0};
+  // Ask the OS to prefetch the next buffer whenever a READ_CACHE is refilled.
+  bool read_ahead{false};
 };
 
 typedef int (*qsort2_cmp)(const void *, const void *, const void *);
@@ -759,6 +761,7 @@ extern int my_b_flush_io_cache(IO_CACHE *info, int need_append_buffer_lock);
 
 extern int end_io_cache(IO_CACHE *info);
 extern size_t my_b_fill(IO_CACHE *info);
+extern void my_b_read_ahead(IO_CACHE *info, my_off_t pos, size_t length);
 extern void my_b_seek(IO_CACHE *info, my_off_t pos);
 extern size_t my_b_gets(IO_CACHE *info, char *to, size_t max_length);
 extern my_off_t my_b_filelength(IO_CACHE *info);
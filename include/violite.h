@@ -260,6 +260,12 @@ int sslaccept(struct st_VioSSLFd *, MYSQL_VIO, long timeout,
 int sslconnect(struct st_VioSSLFd *, MYSQL_VIO, long timeout,
                unsigned long *errptr, SSL **ssl);
 
+/*
+  Enable or disable read-ahead of TLS records on an SSL connection. With
+  read-ahead, has_data() may report a partially received record.
+*/
+void vio_ssl_set_read_ahead(MYSQL_VIO vio, bool read_ahead);
+
 struct st_VioSSLFd *new_VioSSLConnectorFd(
     const char *key_file, const char *cert_file, const char *ca_file,
     const char *ca_path, const char *cipher, const char *ciphersuites,
@@ -547,9 +547,32 @@ int _my_b_read(IO_CACHE *info, uchar *Buffer, size_t Count) {
   info->read_end = info->buffer + length;
   info->pos_in_file = pos_in_file;
   memcpy(Buffer, info->buffer, Count);
+  if (info->read_ahead && info->type == READ_CACHE)
+    my_b_read_ahead(info, pos_in_file + length, info->read_length);
   return 0;
 }
 
+/**
+  Tell the OS that a part of the file underlying a cache will be read soon,
+  so that it can be fetched in the background while the caller processes
+  the data it already has. This is only a hint, and a no-op on platforms
+  without posix_fadvise().
+
+  @param info    IO_CACHE whose file will be read
+  @param pos     Offset in the file where the read will start
+  @param length  Number of bytes that will be read; cropped at end of file
+*/
+void my_b_read_ahead(IO_CACHE *info MY_ATTRIBUTE((unused)),
+                     my_off_t pos MY_ATTRIBUTE((unused)),
+                     size_t length MY_ATTRIBUTE((unused))) {
+#ifdef POSIX_FADV_WILLNEED
+  if (info->file < 0 || pos >= info->end_of_file) return;
+  if (length > info->end_of_file - pos)
+    length = static_cast<size_t>(info->end_of_file - pos);
+  (void)posix_fadvise(info->file, pos, length, POSIX_FADV_WILLNEED);
+#endif /* POSIX_FADV_WILLNEED */
+}
+
 /*
   Prepare IO_CACHE for shared use.
 
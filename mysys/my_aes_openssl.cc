@@ -70,6 +70,34 @@ static uint my_aes_opmode_key_sizes_impl[] = {
 
 uint *my_aes_opmode_key_sizes = my_aes_opmode_key_sizes_impl;
 
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+namespace {
+/**
+  Cipher context reused by all my_aes_encrypt() and my_aes_decrypt() calls
+  of a thread. Tablespace and redo log encryption call these for every page
+  or log block, and allocating a context each time was a significant part
+  of the cost. The context is reset, which also wipes the key schedule,
+  after every use.
+*/
+class Thread_cipher_ctx {
+ public:
+  ~Thread_cipher_ctx() {
+    if (m_ctx != nullptr) EVP_CIPHER_CTX_free(m_ctx);
+  }
+
+  EVP_CIPHER_CTX *get() {
+    if (m_ctx == nullptr) m_ctx = EVP_CIPHER_CTX_new();
+    return m_ctx;
+  }
+
+ private:
+  EVP_CIPHER_CTX *m_ctx{nullptr};
+};
+
+thread_local Thread_cipher_ctx thread_cipher_ctx;
+}  // namespace
+#endif /* OPENSSL_VERSION_NUMBER >= 0x10100000L */
+
 static const EVP_CIPHER *aes_evp_type(const my_aes_opmode mode) {
   switch (mode) {
     case my_aes_128_ecb:
@@ -121,7 +149,7 @@ int my_aes_encrypt(const unsigned char *source, uint32 source_length,
   EVP_CIPHER_CTX stack_ctx;
   EVP_CIPHER_CTX *ctx = &stack_ctx;
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  EVP_CIPHER_CTX *ctx = thread_cipher_ctx.get();
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   const EVP_CIPHER *cipher = aes_evp_type(mode);
   int u_len, f_len;
@@ -142,7 +170,7 @@ int my_aes_encrypt(const unsigned char *source, uint32 source_length,
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
+  EVP_CIPHER_CTX_reset(ctx);
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   return u_len + f_len;
 
@@ -152,7 +180,7 @@ aes_error:
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
+  EVP_CIPHER_CTX_reset(ctx);
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   return MY_AES_BAD_DATA;
 }
@@ -165,7 +193,7 @@ int my_aes_decrypt(const unsigned char *source, uint32 source_length,
   EVP_CIPHER_CTX stack_ctx;
   EVP_CIPHER_CTX *ctx = &stack_ctx;
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  EVP_CIPHER_CTX *ctx = thread_cipher_ctx.get();
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   const EVP_CIPHER *cipher = aes_evp_type(mode);
   int u_len, f_len;
@@ -188,7 +216,7 @@ int my_aes_decrypt(const unsigned char *source, uint32 source_length,
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
+  EVP_CIPHER_CTX_reset(ctx);
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
 
   return u_len + f_len;
@@ -199,7 +227,7 @@ aes_error:
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
+  EVP_CIPHER_CTX_reset(ctx);
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   return MY_AES_BAD_DATA;
 }
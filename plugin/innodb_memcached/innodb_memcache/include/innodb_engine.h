@@ -100,6 +100,8 @@ struct innodb_conn_data_struct {
   ib_tpl_t sel_tpl;              /*!< read tuple */
   ib_tpl_t tpl;                  /*!< read tuple */
   ib_tpl_t idx_tpl;              /*!< read tuple */
+  ib_tpl_t range_tpl;            /*!< upper bound tuple for range
+                                 read */
   void *result;                  /*!< result info */
   void **row_buf;                /*!< row buffer to cache row read,
                                  it is array of 16k pages */
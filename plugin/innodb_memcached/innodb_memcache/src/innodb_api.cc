@@ -660,14 +660,21 @@ ib_err_t innodb_api_search(
   }
 
   /* If it is range select, we will need to setup the upper bound
-  compare tuple */
+  compare tuple. Like the search tuples above, it is created once and
+  kept with the connection, so that a series of range gets does not
+  allocate a new tuple for each key */
   if (range_key && range_key->bound == RANGE_BOUND) {
     assert(sel_only);
 
-    if (meta_index->srch_use_idx == META_USE_SECONDARY) {
-      cmp_tpl = ib_cb_sec_search_tuple_create(cursor_data->idx_read_crsr);
+    if (!cursor_data->range_tpl) {
+      if (meta_index->srch_use_idx == META_USE_SECONDARY) {
+        cmp_tpl = ib_cb_sec_search_tuple_create(cursor_data->idx_read_crsr);
+      } else {
+        cmp_tpl = ib_cb_sec_search_tuple_create(cursor_data->read_crsr);
+      }
+      cursor_data->range_tpl = cmp_tpl;
     } else {
-      cmp_tpl = ib_cb_sec_search_tuple_create(cursor_data->read_crsr);
+      cmp_tpl = cursor_data->range_tpl;
     }
 
     err = innodb_api_setup_field_value(key_tpl, 0, &col_info[CONTAINER_KEY],
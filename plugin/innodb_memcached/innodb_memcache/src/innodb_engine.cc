@@ -551,6 +551,11 @@ static void innodb_conn_clean_data(
     conn_data->sel_tpl = NULL;
   }
 
+  if (conn_data->range_tpl) {
+    ib_cb_tuple_delete(conn_data->range_tpl);
+    conn_data->range_tpl = NULL;
+  }
+
   UNLOCK_CURRENT_CONN_IF_NOT_LOCKED(has_lock, conn_data);
 
   if (free_all) {
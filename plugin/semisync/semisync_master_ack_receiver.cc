@@ -155,6 +155,14 @@ bool Ack_receiver::add_slave(THD *thd) {
   slave.vio = thd->get_protocol_classic()->get_vio();
   slave.vio->mysql_socket.m_psi = nullptr;
   slave.vio->read_timeout = 1;
+  /*
+    run() keeps reading from a slave as long as has_data() says so. With
+    read-ahead, that can be a partial record, and waiting for the rest of
+    it would hold up the acks of all other slaves. The slave sends nothing
+    between its dump request and its first ack, so no data is buffered yet.
+  */
+  if (slave.vio->type == VIO_TYPE_SSL)
+    vio_ssl_set_read_ahead(slave.vio, false);
 
   /* push_back() may throw an exception */
   try {
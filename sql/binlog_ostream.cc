@@ -367,7 +367,7 @@ void Binlog_encryption_ostream::close() {
 
 bool Binlog_encryption_ostream::write(const unsigned char *buffer,
                                       my_off_t length) {
-  const int ENCRYPT_BUFFER_SIZE = 2048;
+  const int ENCRYPT_BUFFER_SIZE = IO_SIZE * 2;
   unsigned char encrypt_buffer[ENCRYPT_BUFFER_SIZE];
   const unsigned char *ptr = buffer;
 
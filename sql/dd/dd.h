@@ -78,6 +78,23 @@ class Dictionary *get_dictionary();
 template <typename X>
 X *create_object();
 
+/**
+  Get the number of lookups of table objects in the shared dictionary
+  cache which were served from the cache and which had to read the
+  object from the dictionary tables, since server start.
+
+  @param [out] hits   Number of cache hits.
+  @param [out] misses Number of cache misses.
+*/
+void get_table_cache_statistics(unsigned long long *hits,
+                                unsigned long long *misses);
+
+/**
+  Resize the part of the shared dictionary cache holding table objects
+  after table_definition_cache has been changed.
+*/
+void update_table_cache_capacity();
+
 ///////////////////////////////////////////////////////////////////////////
 
 }  // namespace dd
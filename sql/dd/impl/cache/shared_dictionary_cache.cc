@@ -22,6 +22,7 @@
 
 #include "sql/dd/impl/cache/shared_dictionary_cache.h"
 
+#include <algorithm>
 #include <atomic>
 
 #include "my_dbug.h"
@@ -45,10 +46,7 @@ void Shared_dictionary_cache::init() {
   instance()->m_map<Collation>()->set_capacity(collation_capacity);
   instance()->m_map<Charset>()->set_capacity(charset_capacity);
 
-  // Set capacity to have room for all connections to leave an element
-  // unused in the cache to avoid frequent cache misses while e.g.
-  // opening a table.
-  instance()->m_map<Abstract_table>()->set_capacity(max_connections);
+  update_table_capacity();
   instance()->m_map<Event>()->set_capacity(event_capacity);
   instance()->m_map<Routine>()->set_capacity(stored_program_def_size);
   instance()->m_map<Schema>()->set_capacity(schema_def_size);
@@ -60,6 +58,17 @@ void Shared_dictionary_cache::init() {
   instance()->m_map<Resource_group>()->set_capacity(resource_group_capacity);
 }
 
+void Shared_dictionary_cache::update_table_capacity() {
+  // Set capacity to have room for all connections to leave an element
+  // unused in the cache to avoid frequent cache misses while e.g.
+  // opening a table. Also keep room for as many objects as there are
+  // definitions in the table definition cache, so that re-opening a table
+  // evicted from that cache does not have to read its definition from the
+  // dictionary tables again.
+  instance()->m_map<Abstract_table>()->set_capacity(
+      std::max<size_t>(max_connections, table_def_size));
+}
+
 void Shared_dictionary_cache::shutdown() {
   instance()->m_map<Abstract_table>()->shutdown();
   instance()->m_map<Collation>()->shutdown();
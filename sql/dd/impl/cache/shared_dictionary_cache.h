@@ -188,6 +188,10 @@ class Shared_dictionary_cache {
   // Set capacity of the shared maps.
   static void init();
 
+  // Set capacity of the table map from the current values of
+  // max_connections and table_definition_cache.
+  static void update_table_capacity();
+
   // Shutdown the shared maps.
   static void shutdown();
 
@@ -197,6 +201,20 @@ class Shared_dictionary_cache {
   // Reset the table and tablespace partitions.
   static bool reset_tables_and_tablespaces(THD *thd);
 
+  /**
+    Get the number of cache hits and misses for objects of type T.
+
+    @tparam       T       Dictionary object type.
+    @param [out]  hits    Lookups served from the shared cache.
+    @param [out]  misses  Lookups read from the dictionary tables.
+  */
+
+  template <typename T>
+  static void get_statistics(ulonglong *hits, ulonglong *misses) {
+    *hits = instance()->m_map<T>()->hits();
+    *misses = instance()->m_map<T>()->misses();
+  }
+
   /**
     Check if an element with the given key is available.
 
@@ -250,7 +250,10 @@ template <typename K>
 bool Shared_multi_map<T>::get(const K &key, Cache_element<T> **element) {
   Autolocker lock(this);
   *element = use_if_present(key);
-  if (*element) return false;
+  if (*element) {
+    m_hits.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
 
   // Is the element already missed?
   if (m_map<K>()->is_missed(key)) {
@@ -265,11 +268,15 @@ bool Shared_multi_map<T>::get(const K &key, Cache_element<T> **element) {
     // it to the cache, before this waiting thread was alerted. Thus,
     // we need to handle this situation as a cache miss if the element
     // is absent.
-    if (*element) return false;
+    if (*element) {
+      m_hits.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
   }
 
   // Mark the key as being missed.
   m_map<K>()->set_missed(key);
+  m_misses.fetch_add(1, std::memory_order_relaxed);
   return true;
 }
 
@@ -24,6 +24,7 @@
 #define DD_CACHE__SHARED_MULTI_MAP_INCLUDED
 
 #include <stdio.h>
+#include <atomic>
 #include <vector>  // std::vector
 
 #include "my_compiler.h"
@@ -186,6 +187,12 @@ class Shared_multi_map : public Multi_map_base<T> {
                        // number of elements exceeds this
                        // limit, shrink the free list.
 
+  // Number of lookups served by the map, and number of lookups which had
+  // to read the object from the dictionary tables. Updated while holding
+  // m_lock, read without it.
+  std::atomic<ulonglong> m_hits{0};
+  std::atomic<ulonglong> m_misses{0};
+
   /**
     Template helper function getting the element map.
 
@@ -335,6 +342,18 @@ class Shared_multi_map : public Multi_map_base<T> {
     rectify_free_list(&lock);
   }
 
+  /**
+    Get the number of lookups served from the map since server start.
+  */
+
+  ulonglong hits() const { return m_hits.load(std::memory_order_relaxed); }
+
+  /**
+    Get the number of lookups that had to handle a cache miss.
+  */
+
+  ulonglong misses() const { return m_misses.load(std::memory_order_relaxed); }
+
   /**
     Check if an element with the given key is available.
   */
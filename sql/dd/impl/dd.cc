@@ -74,6 +74,15 @@ bool shutdown() {
 
 Dictionary *get_dictionary() { return Dictionary_impl::instance(); }
 
+void get_table_cache_statistics(unsigned long long *hits,
+                                unsigned long long *misses) {
+  cache::Shared_dictionary_cache::get_statistics<Abstract_table>(hits, misses);
+}
+
+void update_table_cache_capacity() {
+  cache::Shared_dictionary_cache::update_table_capacity();
+}
+
 template <typename X>
 X *create_object() {
   return dynamic_cast<X *>(new (std::nothrow) typename X::Impl());
@@ -478,15 +478,10 @@ ulonglong Table_statistics::read_stat(
     hton->get_table_statistics is not yet implemented to support
     partitioned table.
   */
-  plugin_ref tmp_plugin = ha_resolve_by_name_raw(
-      thd, lex_cstring_handle(dd::String_type(engine_name_ptr.ptr())));
-  handlerton *hton = nullptr;
-  const bool hton_implements_get_statistics =
-      (tmp_plugin && (hton = plugin_data<handlerton *>(tmp_plugin)) &&
-       hton->get_index_column_cardinality && hton->get_table_statistics);
+  handlerton *hton = get_stats_handlerton(thd, engine_name_ptr);
 
   // Try to get statistics without opening the table.
-  if (!partition_name && hton_implements_get_statistics)
+  if (!partition_name && hton != nullptr)
     result = read_stat_from_SE(
         thd, schema_name_ptr, table_name_ptr, index_name_ptr, column_name_ptr,
         index_ordinal_position, column_ordinal_position, se_private_id,
@@ -515,6 +510,34 @@ ulonglong Table_statistics::read_stat(
   return result;
 }
 
+// Resolve the storage engine used to fetch statistics without opening the
+// table. Consecutive rows of an I_S query mostly share the same engine.
+handlerton *Table_statistics::get_stats_handlerton(
+    THD *thd, const String &engine_name_ptr) {
+  if (m_engine_query_id == thd->query_id &&
+      m_engine_name.length() == engine_name_ptr.length() &&
+      memcmp(m_engine_name.data(), engine_name_ptr.ptr(),
+             engine_name_ptr.length()) == 0)
+    return m_engine_hton;
+
+  m_engine_name.assign(engine_name_ptr.ptr(), engine_name_ptr.length());
+
+  /*
+    Lock the plugin for the statement (it's unlocked in lex_end()), so the
+    handlerton remains valid while it is cached.
+  */
+  plugin_ref tmp_plugin =
+      ha_resolve_by_name_raw(thd, lex_cstring_handle(m_engine_name));
+  handlerton *hton = nullptr;
+  const bool hton_implements_get_statistics =
+      (tmp_plugin && (hton = plugin_data<handlerton *>(tmp_plugin)) &&
+       hton->get_index_column_cardinality && hton->get_table_statistics);
+
+  m_engine_hton = hton_implements_get_statistics ? hton : nullptr;
+  m_engine_query_id = thd->query_id;
+  return m_engine_hton;
+}
+
 // Fetch stats from SE
 ulonglong Table_statistics::read_stat_from_SE(
     THD *thd, const String &schema_name_ptr, const String &table_name_ptr,
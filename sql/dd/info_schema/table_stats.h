@@ -101,7 +101,11 @@ enum class enum_table_stats_type {
 
 class Table_statistics {
  public:
-  Table_statistics() : m_checksum(0), m_read_stats_by_open(false) {}
+  Table_statistics()
+      : m_checksum(0),
+        m_read_stats_by_open(false),
+        m_engine_hton(nullptr),
+        m_engine_query_id(0) {}
 
   /**
     Check if the stats are cached for given db.table_name.
@@ -114,7 +118,7 @@ class Table_statistics {
   */
   bool is_stat_cached_in_mem(const String &db_name, const String &table_name,
                              const char *partition_name) {
-    return (m_key == form_key(db_name, table_name, partition_name));
+    return key_matches(db_name, table_name, partition_name);
   }
 
   bool is_stat_cached_in_mem(const String &db_name, const String &table_name) {
@@ -215,6 +219,9 @@ class Table_statistics {
   void invalidate_cache(void) {
     m_key.clear();
     m_error.clear();
+    m_engine_name.clear();
+    m_engine_hton = nullptr;
+    m_engine_query_id = 0;
   }
 
   // Get error string. Its empty if a error is not reported.
@@ -349,10 +356,55 @@ class Table_statistics {
   */
   String_type form_key(const String &db_name, const String &table_name,
                        const char *partition_name) {
-    return String_type(db_name.ptr()) + "." + String_type(table_name.ptr()) +
+    return String_type(db_name.ptr(), db_name.length()) + "." +
+           String_type(table_name.ptr(), table_name.length()) +
            (partition_name ? ("." + String_type(partition_name)) : "");
   }
 
+  /**
+    Check if the cache key is the one form_key() would build for the given
+    names, without building it. This is done for every dynamic statistics
+    column of every row of an I_S query.
+
+    @param db_name             - Database name.
+    @param table_name          - Table name.
+    @param partition_name      - Partition name.
+
+    @returns true if the key matches.
+  */
+  bool key_matches(const String &db_name, const String &table_name,
+                   const char *partition_name) const {
+    const size_t db_len = db_name.length();
+    const size_t table_len = table_name.length();
+    const size_t part_len = partition_name ? strlen(partition_name) : 0;
+    const size_t key_len =
+        db_len + 1 + table_len + (partition_name ? 1 + part_len : 0);
+
+    if (m_key.length() != key_len) return false;
+
+    const char *key = m_key.data();
+    if (memcmp(key, db_name.ptr(), db_len) != 0 || key[db_len] != '.' ||
+        memcmp(key + db_len + 1, table_name.ptr(), table_len) != 0)
+      return false;
+
+    if (partition_name == nullptr) return true;
+
+    key += db_len + 1 + table_len;
+    return key[0] == '.' && memcmp(key + 1, partition_name, part_len) == 0;
+  }
+
+  /**
+    Get the handlerton of the given storage engine if it can provide table
+    statistics without opening the table. The result is cached for the
+    rest of the statement, as the plugin stays locked until its end.
+
+    @param thd                 - Current thread.
+    @param engine_name_ptr     - Storage engine name.
+
+    @returns handlerton, or nullptr if the table has to be opened.
+  */
+  handlerton *get_stats_handlerton(THD *thd, const String &engine_name_ptr);
+
   /**
     Return statistics of the a given type.
 
@@ -394,6 +446,12 @@ class Table_statistics {
   */
   bool m_read_stats_by_open;
 
+  // Storage engine resolved by the last get_stats_handlerton() call, and
+  // the statement it was resolved for (0 if none).
+  String_type m_engine_name;
+  handlerton *m_engine_hton;
+  int64 m_engine_query_id;
+
  public:
   // Cached statistics.
   ha_statistics m_stats;
@@ -7574,12 +7574,19 @@ type_conversion_status Field_json::store(const char *from, size_t length,
     return TYPE_ERR_BAD_VALUE;
   }
 
+  /*
+    Serialize the text directly to binary format, without building a DOM.
+    If the text was converted to utf8mb4 into Field_blob::value, it
+    cannot be serialized into the same buffer, so use a temporary one,
+    which is copied into Field_blob::value by store_binary().
+  */
+  StringBuffer<STRING_BUFFER_USUAL_SIZE> tmpstr;
+  String *buffer = (s == value.ptr()) ? &tmpstr : &value;
+
   const char *parse_err;
   size_t err_offset;
-  std::unique_ptr<Json_dom> dom(
-      Json_dom::parse(s, ss, &parse_err, &err_offset));
-
-  if (dom.get() == nullptr) {
+  if (json_binary::serialize_text(table->in_use, s, ss, buffer, &parse_err,
+                                  &err_offset)) {
     if (parse_err != nullptr) {
       // Syntax error.
       invalid_text(parse_err, err_offset);
@@ -7587,10 +7594,7 @@ type_conversion_status Field_json::store(const char *from, size_t length,
     return TYPE_ERR_BAD_VALUE;
   }
 
-  if (json_binary::serialize(table->in_use, dom.get(), &value))
-    return TYPE_ERR_BAD_VALUE;
-
-  return store_binary(value.ptr(), value.length());
+  return store_binary(buffer->ptr(), buffer->length());
 }
 
 /**
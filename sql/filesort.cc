@@ -1791,6 +1791,13 @@ static uint read_to_buffer(IO_CACHE *fromfile, Merge_chunk *merge_chunk,
     merge_chunk->advance_file_position(num_bytes_read);
     merge_chunk->decrement_rowcount(count);
     merge_chunk->set_mem_count(count);
+    /*
+      The next read from this chunk will not happen until all chunks
+      have been consumed up to this point; let the OS fetch it meanwhile.
+    */
+    if (merge_chunk->rowcount() > 0)
+      my_b_read_ahead(fromfile, merge_chunk->file_position(),
+                      merge_chunk->buffer_size());
     return num_bytes_read;
   }
 
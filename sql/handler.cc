@@ -6293,6 +6293,7 @@ int handler::multi_range_read_init(RANGE_SEQ_IF *seq_funcs,
   mrr_funcs = *seq_funcs;
   mrr_is_output_sorted = mode & HA_MRR_SORTED;
   mrr_have_range = false;
+  ranges_in_seq = n_ranges;
   return 0;
 }
 
@@ -6373,7 +6374,8 @@ int handler::multi_range_read_next(char **range_info) {
       if (result != HA_ERR_END_OF_FILE) break;
     }
   } while (((result == HA_ERR_END_OF_FILE) ||
-            (m_unique && (dup_found = filter_dup_records()))) &&
+            (m_unique && mrr_range_may_have_dups() &&
+             (dup_found = filter_dup_records()))) &&
            !range_res);
 
   *range_info = mrr_cur_range.ptr;
@@ -8332,6 +8334,17 @@ bool handler::filter_dup_records() {
   return m_unique->unique_add(ref);
 }
 
+bool handler::mrr_range_may_have_dups() const {
+  if (ranges_in_seq != 1 || !(mrr_cur_range.range_flag & EQ_RANGE))
+    return true;
+  const KEY &key = table->key_info[active_index];
+  for (uint i = 0; i < key.user_defined_key_parts; i++) {
+    if (key.key_part[i].field->is_array())
+      return !(mrr_cur_range.start_key.keypart_map & (1UL << i));
+  }
+  return true; /* purecov: inspected */
+}
+
 int handler::ha_extra(enum ha_extra_function operation) {
   if (operation == HA_EXTRA_ENABLE_UNIQUE_RECORD_FILTER) {
     // This operation should be called only for active multi-valued index
@@ -6566,6 +6566,20 @@ class handler {
   */
   bool filter_dup_records();
 
+  /**
+    Check whether records read from the current MRR range have to be passed
+    through the multi-valued index duplicate filter.
+
+    A multi-valued index holds at most one entry per distinct value of a
+    record's array, so a sequence consisting of a single equality range
+    over the multi-valued key part can't return the same record twice.
+
+    @returns
+      true  records may be duplicates and have to be filtered
+      false every record of the current range is seen for the first time
+  */
+  bool mrr_range_may_have_dups() const;
+
  protected:
   Handler_share *get_ha_share_ptr();
   void set_ha_share_ptr(Handler_share *arg_ha_share);
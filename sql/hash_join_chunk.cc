@@ -67,6 +67,8 @@ bool HashJoinChunk::Init(const hash_join_buffer::TableCollection &tables,
                          bool uses_match_flags) {
   m_tables = tables;
   m_file.file_key = key_file_hash_join;
+  // Chunk files are always read sequentially from start to end.
+  m_file.read_ahead = true;
   m_num_rows = 0;
   m_uses_match_flags = uses_match_flags;
   return open_cached_file(&m_file, mysql_tmpdir, TEMP_PREFIX, DISK_BUFFER_SIZE,
@@ -808,6 +808,20 @@ bool Arg_comparator::set_compare_func(Item_result_field *item,
         else if ((*right)->unsigned_flag)
           func = &Arg_comparator::compare_int_signed_unsigned;
       }
+      /*
+        Comparing an expression with an integer literal is the most common
+        form in WHERE clauses, so read the literal only once.
+      */
+      m_const_item = nullptr;
+      if ((func == &Arg_comparator::compare_int_signed ||
+           func == &Arg_comparator::compare_int_unsigned) &&
+          (*right)->type() == Item::INT_ITEM && !(*left)->const_item()) {
+        m_const_item = *right;
+        m_const_int = (*right)->val_int();
+        func = func == &Arg_comparator::compare_int_signed
+                   ? &Arg_comparator::compare_int_signed_const
+                   : &Arg_comparator::compare_int_unsigned_const;
+      }
       break;
     }
     case DECIMAL_RESULT:
@@ -1847,6 +1861,44 @@ int Arg_comparator::compare_int_unsigned() {
   return -1;
 }
 
+/**
+  Compare signed (*left) with the integer literal (*right) whose value was
+  read when the comparator was set up. Falls back to the generic comparison
+  if (*right) has been substituted since.
+*/
+
+int Arg_comparator::compare_int_signed_const() {
+  if (*right != m_const_item) return compare_int_signed();
+  const longlong val1 = (*left)->val_int();
+  if (!(*left)->null_value) {
+    if (set_null) owner->null_value = false;
+    if (val1 < m_const_int) return -1;
+    if (val1 == m_const_int) return 0;
+    return 1;
+  }
+  if (set_null) owner->null_value = true;
+  return -1;
+}
+
+/**
+  Compare unsigned (*left) with the unsigned integer literal (*right), see
+  compare_int_signed_const().
+*/
+
+int Arg_comparator::compare_int_unsigned_const() {
+  if (*right != m_const_item) return compare_int_unsigned();
+  const ulonglong val1 = (*left)->val_int();
+  if (!(*left)->null_value) {
+    const ulonglong val2 = static_cast<ulonglong>(m_const_int);
+    if (set_null) owner->null_value = false;
+    if (val1 < val2) return -1;
+    if (val1 == val2) return 0;
+    return 1;
+  }
+  if (set_null) owner->null_value = true;
+  return -1;
+}
+
 /**
   Compare signed (*left) with unsigned (*B)
 */
@@ -4146,9 +4198,54 @@ class Cmp_longlong {
   }
 };
 
+in_longlong::in_longlong(MEM_ROOT *mem_root, uint elements)
+    : in_vector(elements), base(mem_root, elements), m_hash(mem_root) {
+  if (elements >= MIN_HASH_ELEMENTS) {
+    // Keep the load factor at or below 1/2. Without memory, use bisection.
+    size_t slots = 1;
+    while (slots < 2 * static_cast<size_t>(elements)) slots <<= 1;
+    if (!m_hash.reserve(slots)) m_hash.resize(slots);
+  }
+}
+
 void in_longlong::resize_and_sort() {
   base.resize(used_count);
   std::sort(base.begin(), base.end(), Cmp_longlong());
+  build_hash();
+}
+
+/**
+  (Re)build the hash table from the values in base. The table is sized for
+  the original number of elements, so it never needs to grow.
+*/
+void in_longlong::build_hash() {
+  if (m_hash.empty()) return;
+  std::fill(m_hash.begin(), m_hash.end(), hash_slot{0, 0});
+  for (const packed_longlong &elem : base) {
+    size_t pos = hash_pos(elem.val);
+    while (m_hash[pos].flags != 0 && m_hash[pos].val != elem.val)
+      pos = (pos + 1) & (m_hash.size() - 1);
+    m_hash[pos].val = elem.val;
+    m_hash[pos].flags |= elem.unsigned_flag ? SLOT_UNSIGNED : SLOT_SIGNED;
+  }
+}
+
+/**
+  Look up a value in the hash table, with the same semantics as
+  cmp_longlong(): values of different signedness are only equal if they are
+  in the positive signed range.
+*/
+bool in_longlong::find_in_hash(const packed_longlong &value) const {
+  size_t pos = hash_pos(value.val);
+  while (m_hash[pos].flags != 0) {
+    if (m_hash[pos].val == value.val) {
+      if (value.val >= 0) return true;
+      return m_hash[pos].flags &
+             (value.unsigned_flag ? SLOT_UNSIGNED : SLOT_SIGNED);
+    }
+    pos = (pos + 1) & (m_hash.size() - 1);
+  }
+  return false;
 }
 
 bool in_longlong::find_item(Item *item) {
@@ -4156,6 +4253,7 @@ bool in_longlong::find_item(Item *item) {
   packed_longlong result;
   val_item(item, &result);
   if (item->null_value) return false;
+  if (!m_hash.empty()) return find_in_hash(result);
   return std::binary_search(base.begin(), base.end(), result, Cmp_longlong());
 }
 
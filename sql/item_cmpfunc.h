@@ -159,6 +159,14 @@ class Arg_comparator {
   */
   size_t m_max_str_length{0};
 
+  /**
+    Literal integer on the right side, and its value, when the comparison
+    was specialized by compare_int_*_const(). The value is evaluated once
+    at resolution time instead of once per row.
+  */
+  const Item *m_const_item{nullptr};
+  longlong m_const_int{0};
+
  public:
   DTCollation cmp_collation;
   /* Allow owner function to use string buffers. */
@@ -217,6 +225,8 @@ class Arg_comparator {
   int compare_int_signed_unsigned();
   int compare_int_unsigned_signed();
   int compare_int_unsigned();
+  int compare_int_signed_const();
+  int compare_int_unsigned_const();
   int compare_time_packed();
   int compare_row();  // compare args[0] & args[1]
   int compare_real_fixed();
@@ -1575,9 +1585,39 @@ class in_longlong : public in_vector {
  protected:
   Mem_root_array<packed_longlong> base;
 
+ private:
+  /**
+    Slot of the open addressing hash table used for long IN-lists. Values
+    are keyed by their bits; the flags tell whether the value is present
+    as a signed and/or as an unsigned integer.
+  */
+  struct hash_slot {
+    longlong val;
+    uchar flags;
+  };
+  static constexpr uchar SLOT_SIGNED = 1;
+  static constexpr uchar SLOT_UNSIGNED = 2;
+
+  /**
+    Lists with at least this many elements are looked up through m_hash
+    instead of by binary search in base.
+  */
+  static constexpr uint MIN_HASH_ELEMENTS = 16;
+
+  /// Hash table over base, power of two sized; empty if not used.
+  Mem_root_array<hash_slot> m_hash;
+
+  size_t hash_pos(longlong val) const {
+    return static_cast<size_t>((static_cast<ulonglong>(val) *
+                                0x9E3779B97F4A7C15ULL) >>
+                               32) &
+           (m_hash.size() - 1);
+  }
+  void build_hash();
+  bool find_in_hash(const packed_longlong &value) const;
+
  public:
-  in_longlong(MEM_ROOT *mem_root, uint elements)
-      : in_vector(elements), base(mem_root, elements) {}
+  in_longlong(MEM_ROOT *mem_root, uint elements);
   Item_basic_constant *create_item(MEM_ROOT *mem_root) const override {
     /*
       We've created a signed INT, this may not be correct in the
@@ -26,6 +26,7 @@
 #include <sys/types.h>
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 #include "field_types.h"  // MYSQL_TYPE_BLOB
@@ -38,6 +39,8 @@
 #include "prealloced_array.h"
 #include "sql/enum_query_type.h"
 #include "sql/field.h"
+#include "sql/gis/box.h"
+#include "sql/gis/geometries.h"
 #include "sql/gis/srid.h"
 #include "sql/parse_location.h"  // POS
 /* This file defines all spatial functions */
@@ -1056,6 +1059,7 @@ class Item_func_spatial_relation : public Item_bool_func2 {
     val_int();
     return null_value;
   }
+  void cleanup() override;
 
   /**
     Evaluate the spatial relation function.
@@ -1072,6 +1076,62 @@ class Item_func_spatial_relation : public Item_bool_func2 {
   virtual bool eval(const dd::Spatial_reference_system *srs,
                     const gis::Geometry *g1, const gis::Geometry *g2,
                     bool *result, bool *null) = 0;
+
+ private:
+  /**
+    The value of an argument that is constant for one execution while the
+    other argument is not, e.g., @region in ST_Contains(@region, point_col).
+    It is parsed once and reused for every row instead of being parsed
+    again each time.
+  */
+  struct Constant_geometry {
+    /// True if the value has been cached.
+    bool cached{false};
+    /// True if the argument is NULL.
+    bool is_null{false};
+    /// SRID of the geometry.
+    gis::srid_t srid{0};
+    /// The parsed geometry.
+    std::unique_ptr<gis::Geometry> geometry;
+    /// True if mbr has been computed, i.e., the geometry is Cartesian and
+    /// not empty.
+    bool has_mbr{false};
+    /// Bounding box of the geometry.
+    gis::Cartesian_box mbr;
+  };
+
+  /**
+    Check if an argument should be cached in m_const_args.
+
+    @param arg Index of the argument.
+
+    @retval true The argument is constant and the other one is not.
+    @retval false Otherwise.
+  */
+  bool cache_arg(uint arg) const {
+    return args[arg]->const_for_execution() &&
+           !args[1 - arg]->const_for_execution();
+  }
+
+  /**
+    Decide the result without calling eval() if the bounding box of a
+    cached argument is disjoint from the bounding box of the other
+    argument.
+
+    @param[in] srs Spatial reference system common to both g1 and g2.
+    @param[in] g1 First geometry.
+    @param[in] g2 Second geometry.
+    @param[out] result Result of the relational operation.
+
+    @retval true The result has been decided.
+    @retval false eval() must be called.
+  */
+  bool mbrs_are_disjoint(const dd::Spatial_reference_system *srs,
+                         const gis::Geometry *g1, const gis::Geometry *g2,
+                         bool *result) const;
+
+  /// Cached constant arguments.
+  Constant_geometry m_const_args[2];
 };
 
 class Item_func_st_contains final : public Item_func_spatial_relation {
@@ -41,6 +41,7 @@
 #include "sql/dd/types/spatial_reference_system.h"
 #include "sql/derror.h"  // ER_THD
 #include "sql/gis/geometries.h"
+#include "sql/gis/mbr_utils.h"
 #include "sql/gis/relops.h"
 #include "sql/gis/srid.h"
 #include "sql/gis/wkb.h"
@@ -1118,44 +1119,74 @@ longlong Item_func_spatial_relation::val_int() {
   DBUG_TRACE;
   DBUG_ASSERT(fixed);
 
-  String tmp_value1;
-  String tmp_value2;
-  String *res1 = args[0]->val_str(&tmp_value1);
-  String *res2 = args[1]->val_str(&tmp_value2);
+  String tmp_value[2];
+  String *res[2] = {nullptr, nullptr};
+  bool arg_is_null = false;
+  for (uint i = 0; i < 2; i++) {
+    Constant_geometry &const_arg = m_const_args[i];
+    if (const_arg.cached) {
+      arg_is_null |= const_arg.is_null;
+      continue;
+    }
 
-  if ((null_value =
-           (!res1 || args[0]->null_value || !res2 || args[1]->null_value))) {
-    DBUG_ASSERT(maybe_null);
-    return 0;
+    res[i] = args[i]->val_str(&tmp_value[i]);
+    if (res[i] == nullptr || args[i]->null_value) {
+      arg_is_null = true;
+      if (cache_arg(i)) const_arg.cached = const_arg.is_null = true;
+    }
   }
 
-  if (res1 == nullptr || res2 == nullptr) {
-    DBUG_ASSERT(false);
-    my_error(ER_GIS_INVALID_DATA, MYF(0), func_name());
-    return error_int();
+  if ((null_value = arg_is_null)) {
+    DBUG_ASSERT(maybe_null);
+    return 0;
   }
 
-  const dd::Spatial_reference_system *srs1 = nullptr;
-  const dd::Spatial_reference_system *srs2 = nullptr;
-  std::unique_ptr<gis::Geometry> g1;
-  std::unique_ptr<gis::Geometry> g2;
+  const dd::Spatial_reference_system *srs = nullptr;
+  const gis::Geometry *g[2];
+  gis::srid_t srid[2];
+  std::unique_ptr<gis::Geometry> parsed[2];
   std::unique_ptr<dd::cache::Dictionary_client::Auto_releaser> releaser(
       new dd::cache::Dictionary_client::Auto_releaser(
           current_thd->dd_client()));
-  if (gis::parse_geometry(current_thd, func_name(), res1, &srs1, &g1) ||
-      gis::parse_geometry(current_thd, func_name(), res2, &srs2, &g2)) {
-    return error_int();
+  for (uint i = 0; i < 2; i++) {
+    Constant_geometry &const_arg = m_const_args[i];
+    if (const_arg.cached) {
+      g[i] = const_arg.geometry.get();
+      srid[i] = const_arg.srid;
+      continue;
+    }
+
+    // At least one argument is parsed for every row, so srs is always set
+    // from a geometry that is compatible with the cached one.
+    const dd::Spatial_reference_system *arg_srs = nullptr;
+    if (gis::parse_geometry(current_thd, func_name(), res[i], &arg_srs,
+                            &parsed[i]))
+      return error_int();
+    if (srs == nullptr) srs = arg_srs;
+    srid[i] = arg_srs == nullptr ? 0 : arg_srs->id();
+    g[i] = parsed[i].get();
+
+    if (cache_arg(i)) {
+      const_arg.srid = srid[i];
+      const_arg.geometry = std::move(parsed[i]);
+      if (g[i]->coordinate_system() == gis::Coordinate_system::kCartesian &&
+          !g[i]->is_empty()) {
+        gis::box_envelope(g[i], arg_srs, &const_arg.mbr);
+        const_arg.has_mbr = !gis::mbr_is_empty(const_arg.mbr);
+      }
+      const_arg.cached = true;
+    }
   }
 
-  gis::srid_t srid1 = srs1 == nullptr ? 0 : srs1->id();
-  gis::srid_t srid2 = srs2 == nullptr ? 0 : srs2->id();
-  if (srid1 != srid2) {
-    my_error(ER_GIS_DIFFERENT_SRIDS, MYF(0), func_name(), srid1, srid2);
+  if (srid[0] != srid[1]) {
+    my_error(ER_GIS_DIFFERENT_SRIDS, MYF(0), func_name(), srid[0], srid[1]);
     return error_int();
   }
 
   bool result;
-  bool error = eval(srs1, g1.get(), g2.get(), &result, &null_value);
+  if (mbrs_are_disjoint(srs, g[0], g[1], &result)) return result;
+
+  bool error = eval(srs, g[0], g[1], &result, &null_value);
 
   if (error) return error_int();
 
@@ -1167,6 +1198,65 @@ longlong Item_func_spatial_relation::val_int() {
   return result;
 }
 
+void Item_func_spatial_relation::cleanup() {
+  Item_bool_func2::cleanup();
+  for (Constant_geometry &const_arg : m_const_args) {
+    const_arg.cached = false;
+    const_arg.is_null = false;
+    const_arg.geometry.reset();
+    const_arg.has_mbr = false;
+  }
+}
+
+bool Item_func_spatial_relation::mbrs_are_disjoint(
+    const dd::Spatial_reference_system *srs, const gis::Geometry *g1,
+    const gis::Geometry *g2, bool *result) const {
+  // Relations that may return NULL for non-empty geometries, e.g.,
+  // ST_Crosses, are always passed on to eval().
+  switch (functype()) {
+    case SP_DISJOINT_FUNC:
+      *result = true;
+      break;
+    case SP_CONTAINS_FUNC:
+    case SP_COVEREDBY_FUNC:
+    case SP_COVERS_FUNC:
+    case SP_EQUALS_FUNC:
+    case SP_INTERSECTS_FUNC:
+    case SP_WITHIN_FUNC:
+      *result = false;
+      break;
+    default:
+      return false;
+  }
+
+  const gis::Cartesian_box *cached_mbr;
+  const gis::Geometry *other;
+  if (m_const_args[0].has_mbr) {
+    cached_mbr = &m_const_args[0].mbr;
+    other = g2;
+  } else if (m_const_args[1].has_mbr) {
+    cached_mbr = &m_const_args[1].mbr;
+    other = g1;
+  } else {
+    return false;
+  }
+
+  if (other->coordinate_system() != gis::Coordinate_system::kCartesian ||
+      other->is_empty())
+    return false;
+
+  gis::Cartesian_box other_mbr;
+  gis::box_envelope(other, srs, &other_mbr);
+  if (gis::mbr_is_empty(other_mbr)) return false;
+
+  // Boxes that only touch are not disjoint, so the boundary semantics of
+  // each relation are left to eval().
+  return cached_mbr->max_corner().x() < other_mbr.min_corner().x() ||
+         other_mbr.max_corner().x() < cached_mbr->min_corner().x() ||
+         cached_mbr->max_corner().y() < other_mbr.min_corner().y() ||
+         other_mbr.max_corner().y() < cached_mbr->min_corner().y();
+}
+
 bool Item_func_st_contains::eval(const dd::Spatial_reference_system *srs,
                                  const gis::Geometry *g1,
                                  const gis::Geometry *g2, bool *result,
@@ -471,6 +471,23 @@ bool Json_path_cache::parse_and_cache_path(Item **args, uint arg_idx,
     return cell.m_status == enum_path_status::ERROR;
   }
 
+  const String *path_value = arg->val_str(&m_path_value);
+  bool null_value = (path_value == nullptr);
+
+  /*
+    A non-constant path expression often evaluates to the same text for
+    many consecutive rows, for example when it comes from a column in a
+    small table joined with the table holding the documents. Reuse the
+    path parsed for the previous row if the text hasn't changed.
+  */
+  if (!is_constant && !null_value &&
+      cell.m_status == enum_path_status::OK_NOT_NULL &&
+      cell.m_text_charset == path_value->charset() &&
+      cell.m_text.length() == path_value->length() &&
+      memcmp(cell.m_text.data(), path_value->ptr(), path_value->length()) ==
+          0)
+    return false;
+
   if (cell.m_status == enum_path_status::UNINITIALIZED) {
     cell.m_index = m_paths.size();
     if (m_paths.emplace_back()) return true; /* purecov: inspected */
@@ -479,8 +496,6 @@ bool Json_path_cache::parse_and_cache_path(Item **args, uint arg_idx,
     m_paths[cell.m_index].clear();
   }
 
-  const String *path_value = arg->val_str(&m_path_value);
-  bool null_value = (path_value == nullptr);
   if (!null_value &&
       parse_path(*path_value, forbid_wildcards, &m_paths[cell.m_index])) {
     // oops, parsing failed
@@ -491,6 +506,11 @@ bool Json_path_cache::parse_and_cache_path(Item **args, uint arg_idx,
   cell.m_status =
       null_value ? enum_path_status::OK_NULL : enum_path_status::OK_NOT_NULL;
 
+  if (!is_constant && !null_value) {
+    cell.m_text.assign(path_value->ptr(), path_value->length());
+    cell.m_text_charset = path_value->charset();
+  }
+
   return false;
 }
 
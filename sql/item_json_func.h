@@ -28,6 +28,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <utility>  // std::forward
 
 #include "m_ctype.h"
@@ -98,6 +99,13 @@ class Json_path_cache {
   struct Path_cell {
     enum_path_status m_status = enum_path_status::UNINITIALIZED;
     size_t m_index = 0;
+    /**
+      For non-constant path expressions, the text and character set the
+      cached path was parsed from. If the next row has the same path
+      text, the cached path is reused instead of being parsed again.
+    */
+    std::string m_text;
+    const CHARSET_INFO *m_text_charset = nullptr;
   };
 
   /// Map argument indexes to indexes into m_paths.
@@ -1826,7 +1826,9 @@ Item_sum_sum::Item_sum_sum(THD *thd, Item_sum_sum *item)
       hybrid_type(item->hybrid_type),
       curr_dec_buff(item->curr_dec_buff),
       m_count(item->m_count),
-      m_frame_null_count(item->m_frame_null_count) {
+      m_frame_null_count(item->m_frame_null_count),
+      m_int_sum(item->m_int_sum),
+      m_int_sum_scale(item->m_int_sum_scale) {
   /* TODO: check if the following assignments are really needed */
   if (hybrid_type == DECIMAL_RESULT) {
     my_decimal2decimal(item->dec_buffs, dec_buffs);
@@ -1848,6 +1850,8 @@ void Item_sum_sum::clear() {
     curr_dec_buff = 0;
     my_decimal_set_zero(&dec_buffs[0]);
     my_decimal_set_zero(&dec_buffs[1]);
+    m_int_sum = 0;
+    m_int_sum_scale = -1;
   } else
     sum = 0.0;
   m_count = 0;
@@ -1923,10 +1927,55 @@ bool Item_sum_sum::check_wf_semantics1(THD *thd, SELECT_LEX *select,
   return result;
 }
 
+bool Item_sum_sum::add_to_int_sum() {
+  if (aggr->Aggrtype() != Aggregator::SIMPLE_AGGREGATOR ||
+      args[0]->type() != Item::FIELD_ITEM)
+    return false;
+
+  Field *field = down_cast<Item_field *>(args[0])->field;
+  if (field->type() != MYSQL_TYPE_NEWDECIMAL) return false;
+
+  const Field_new_decimal *dec_field = down_cast<Field_new_decimal *>(field);
+  if (dec_field->precision > DECIMAL_LONGLONG_PRECISION) return false;
+
+  // Keep null_value up to date as val_decimal() would, it is used by
+  // Aggregator_simple::arg_is_null().
+  if ((args[0]->null_value = dec_field->is_null())) return true;
+
+  longlong value;
+  if (bin2scaled_longlong(dec_field->field_ptr(), &value, dec_field->precision,
+                          dec_field->dec) != E_DEC_OK)
+    return false;
+
+  if (m_int_sum_scale != static_cast<int>(dec_field->dec) ||
+      (value > 0 && m_int_sum > LLONG_MAX - value) ||
+      (value < 0 && m_int_sum < LLONG_MIN - value)) {
+    flush_int_sum();
+    m_int_sum_scale = dec_field->dec;
+  }
+  m_int_sum += value;
+  null_value = false;
+  return true;
+}
+
+void Item_sum_sum::flush_int_sum() {
+  if (m_int_sum_scale < 0) return;
+
+  my_decimal value;
+  scaled_longlong2decimal(m_int_sum, m_int_sum_scale, &value);
+  my_decimal_add(E_DEC_FATAL_ERROR, dec_buffs + (curr_dec_buff ^ 1), &value,
+                 dec_buffs + curr_dec_buff);
+  curr_dec_buff ^= 1;
+  m_int_sum = 0;
+  m_int_sum_scale = -1;
+}
+
 bool Item_sum_sum::add() {
   DBUG_TRACE;
   DBUG_ASSERT(!m_is_window_function);
   if (hybrid_type == DECIMAL_RESULT) {
+    if (add_to_int_sum()) return false;
+
     my_decimal value;
     const my_decimal *val = aggr->arg_val_decimal(&value);
     if (!aggr->arg_is_null(true)) {
@@ -1958,6 +2007,7 @@ longlong Item_sum_sum::val_int() {
 
   if (aggr) aggr->endup();
   if (hybrid_type == DECIMAL_RESULT) {
+    flush_int_sum();
     longlong result;
     my_decimal2int(E_DEC_FATAL_ERROR, dec_buffs + curr_dec_buff, unsigned_flag,
                    &result);
@@ -2004,8 +2054,10 @@ double Item_sum_sum::val_real() {
     return sum;
   } else {
     if (aggr) aggr->endup();
-    if (hybrid_type == DECIMAL_RESULT)
+    if (hybrid_type == DECIMAL_RESULT) {
+      flush_int_sum();
       my_decimal2double(E_DEC_FATAL_ERROR, dec_buffs + curr_dec_buff, &sum);
+    }
     return sum;
   }
 }
@@ -2056,7 +2108,10 @@ my_decimal *Item_sum_sum::val_decimal(my_decimal *val) {
   }
 
   if (aggr) aggr->endup();
-  if (hybrid_type == DECIMAL_RESULT) return (dec_buffs + curr_dec_buff);
+  if (hybrid_type == DECIMAL_RESULT) {
+    flush_int_sum();
+    return (dec_buffs + curr_dec_buff);
+  }
   return val_decimal_from_real(val);
 }
 
@@ -2368,6 +2423,7 @@ my_decimal *Item_sum_avg::val_decimal(my_decimal *val) {
       return result;
     }
 
+    flush_int_sum();
     sum_dec = dec_buffs + curr_dec_buff;
     int2my_decimal(E_DEC_FATAL_ERROR, m_count, false, &cnt);
     my_decimal_div(E_DEC_FATAL_ERROR, val, sum_dec, &cnt, prec_increment);
@@ -1034,6 +1034,32 @@ class Item_sum_sum : public Item_sum_num {
   */
   ulonglong m_frame_null_count;
 
+  /**
+    Execution state: part of a DECIMAL sum that has not yet been added to
+    dec_buffs. It is the sum of the values of a small DECIMAL column,
+    i.e. with a precision of at most DECIMAL_LONGLONG_PRECISION, read
+    straight from the record and scaled by 10^#m_int_sum_scale. This
+    avoids both the decimal_t conversion and decimal_add() for every row.
+  */
+  longlong m_int_sum{0};
+
+  /**
+    Execution state: the scale of #m_int_sum, or -1 if there is no pending
+    integer sum.
+  */
+  int m_int_sum_scale{-1};
+
+  /**
+    Add the argument to #m_int_sum if it is a small DECIMAL column.
+
+    @retval true The argument has been added, or it is NULL.
+    @retval false The argument must be added as a my_decimal.
+  */
+  bool add_to_int_sum();
+
+  /// Add #m_int_sum to dec_buffs.
+  void flush_int_sum();
+
  public:
   Item_sum_sum(const POS &pos, Item *item_par, bool distinct, PT_window *window)
       : Item_sum_num(pos, item_par, window),
@@ -23,7 +23,8 @@
 #include "sql/json_binary.h"
 
 #include <string.h>
-#include <algorithm>  // std::min
+#include <algorithm>  // std::min, std::stable_sort
+#include <cmath>      // std::isfinite
 #include <map>
 #include <memory>
 #include <string>
@@ -35,7 +36,13 @@
 #include "my_sys.h"
 #include "mysqld_error.h"
 #ifdef MYSQL_SERVER
+#include "my_rapidjson_size_t.h"  // IWYU pragma: keep
+#include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+#include "prealloced_array.h"
 #include "sql/check_stack.h"
+#include "sql/psi_memory_key.h"  // key_memory_JSON
 #endif
 #include "sql/field.h"     // Field_json
 #include "sql/json_dom.h"  // Json_dom
@@ -860,6 +867,468 @@ static enum_serialization_result serialize_json_value(
 
   return result;
 }
+
+/**
+  A RapidJSON SAX handler which serializes a JSON text directly into
+  the binary format, without building a Json_dom tree first.
+
+  The binary format stores the header of an array or an object (the
+  element count, the size in bytes and the value entries) in front of
+  the elements, and the size of the header depends on whether the
+  small or the large storage format is used. The handler therefore
+  keeps every element of the containers that are being parsed in a
+  scratch buffer, along with a pending entry which describes its type,
+  its key and where its serialized bytes are. When a container is
+  closed, its members are sorted on key in place, the storage format
+  is chosen from the now known sizes, and the finished container
+  replaces its elements in the scratch buffer. Since all offsets in
+  the binary format are relative to the start of the enclosing
+  container, an element which has been serialized once can be copied
+  into its parent as is.
+
+  The output is byte for byte identical to what json_binary::serialize()
+  produces for the DOM built by Json_dom::parse() from the same text.
+*/
+class Binary_serializing_handler {
+ public:
+  explicit Binary_serializing_handler(const THD *thd)
+      : m_thd(thd),
+        m_entries(key_memory_JSON),
+        m_frames(key_memory_JSON),
+        m_order(key_memory_JSON),
+        m_error_raised(false) {}
+
+  /**
+    Write the serialized document to a string, replacing any content
+    already in it. Should only be called after a successful parse.
+
+    @param[out] dest  the destination string
+    @retval false on success
+    @retval true if an error occurred
+  */
+  bool get_binary(String *dest) const {
+    DBUG_ASSERT(m_frames.empty() && m_entries.size() == 1);
+    const Pending_value &root = m_entries[0];
+
+    dest->length(0);
+    dest->set_charset(&my_charset_bin);
+    if (reserve(dest, root.m_value_length + 1) || dest->append(root.m_type) ||
+        dest->append(m_scratch.ptr() + root.m_value_offset,
+                     root.m_value_length))
+      return true; /* purecov: inspected */
+
+    // Also covers top-level scalars, which never close a container.
+    if (dest->length() > m_thd->variables.max_allowed_packet) {
+      my_error(ER_WARN_ALLOWED_PACKET_OVERFLOWED, MYF(0),
+               "json_binary::serialize", m_thd->variables.max_allowed_packet);
+      return true;
+    }
+    return false;
+  }
+
+  /**
+    @return true if parsing was stopped because of an error which has
+    already been reported with my_error(), and which is not a syntax
+    error in the JSON text
+  */
+  bool error_raised() const { return m_error_raised; }
+
+  bool Null() { return seeing_literal(JSONB_NULL_LITERAL); }
+
+  bool Bool(bool b) {
+    return seeing_literal(b ? JSONB_TRUE_LITERAL : JSONB_FALSE_LITERAL);
+  }
+
+  bool Int(int i) { return seeing_int(i); }
+
+  // Json_dom::parse() stores unsigned 32-bit numbers as signed JSON integers.
+  bool Uint(unsigned u) { return seeing_int(static_cast<longlong>(u)); }
+
+  bool Int64(int64_t i) { return seeing_int(i); }
+
+  bool Uint64(uint64_t ui64) {
+    const size_t pos = m_scratch.length();
+    char type;
+    bool err;
+    if (ui64 <= UINT_MAX16) {
+      type = JSONB_TYPE_UINT16;
+      err = append_int16(&m_scratch, static_cast<int16>(ui64));
+    } else if (ui64 <= UINT_MAX32) {
+      type = JSONB_TYPE_UINT32;
+      err = append_int32(&m_scratch, static_cast<int32>(ui64));
+    } else {
+      type = JSONB_TYPE_UINT64;
+      err = append_int64(&m_scratch, ui64);
+    }
+    return !err && seeing_value(type, pos);
+  }
+
+  bool Double(double d) {
+    // Only finite values are accepted, like in Json_dom::parse().
+    if (!std::isfinite(d)) return false;
+    const size_t pos = m_scratch.length();
+    if (reserve(&m_scratch, 8)) return false; /* purecov: inspected */
+    float8store(m_scratch.ptr() + pos, d);
+    m_scratch.length(pos + 8);
+    return seeing_value(JSONB_TYPE_DOUBLE, pos);
+  }
+
+  /* purecov: begin deadcode */
+  bool RawNumber(const char *, rapidjson::SizeType, bool) {
+    /*
+      Never called, since we don't instantiate the parser with
+      kParseNumbersAsStringsFlag.
+    */
+    DBUG_ASSERT(false);
+    return false;
+  }
+  /* purecov: end */
+
+  bool String(const char *str, rapidjson::SizeType length, bool) {
+    const size_t pos = m_scratch.length();
+    if (append_variable_length(&m_scratch, length) ||
+        m_scratch.append(str, length))
+      return raised_error(); /* purecov: inspected */
+    return seeing_value(JSONB_TYPE_STRING, pos);
+  }
+
+  bool Key(const char *str, rapidjson::SizeType len, bool) {
+    DBUG_ASSERT(!m_frames.empty() && m_frames.back().m_is_object);
+    // We only have two bytes for the key size. Check if the key is too big.
+    if (len > UINT_MAX16) {
+      my_error(ER_JSON_KEY_TOO_BIG, MYF(0));
+      return raised_error();
+    }
+    m_key_offset = m_keys.length();
+    m_key_length = len;
+    return !m_keys.append(str, len) || raised_error();
+  }
+
+  bool StartObject() { return start_container(true); }
+
+  bool EndObject(rapidjson::SizeType) { return end_container(); }
+
+  bool StartArray() { return start_container(false); }
+
+  bool EndArray(rapidjson::SizeType) { return end_container(); }
+
+ private:
+  /// An element which has been parsed, but not yet written to its parent.
+  struct Pending_value {
+    /// Offset of the member name in m_keys. Only used for object members.
+    size_t m_key_offset;
+    /// Length of the member name. Only used for object members.
+    size_t m_key_length;
+    /// Offset of the serialized value in m_scratch.
+    size_t m_value_offset;
+    /// Length of the serialized value.
+    size_t m_value_length;
+    /// The JSONB_TYPE_* type identifier of the value.
+    char m_type;
+  };
+
+  /// An array or object which is currently being parsed.
+  struct Open_container {
+    bool m_is_object;
+    /// Index of the first element in m_entries.
+    size_t m_first_entry;
+    /// Where the elements start in m_scratch.
+    size_t m_scratch_start;
+    /// Where the member names start in m_keys.
+    size_t m_keys_start;
+    /// The name of this container in its parent, if the parent is an object.
+    size_t m_key_offset;
+    size_t m_key_length;
+  };
+
+  bool raised_error() {
+    m_error_raised = true;
+    return false;
+  }
+
+  bool seeing_literal(char literal) {
+    const size_t pos = m_scratch.length();
+    return (!m_scratch.append(literal) || raised_error()) &&
+           seeing_value(JSONB_TYPE_LITERAL, pos);
+  }
+
+  bool seeing_int(longlong val) {
+    const size_t pos = m_scratch.length();
+    char type;
+    bool err;
+    if (INT_MIN16 <= val && val <= INT_MAX16) {
+      type = JSONB_TYPE_INT16;
+      err = append_int16(&m_scratch, static_cast<int16>(val));
+    } else if (INT_MIN32 <= val && val <= INT_MAX32) {
+      type = JSONB_TYPE_INT32;
+      err = append_int32(&m_scratch, static_cast<int32>(val));
+    } else {
+      type = JSONB_TYPE_INT64;
+      err = append_int64(&m_scratch, val);
+    }
+    return (!err || raised_error()) && seeing_value(type, pos);
+  }
+
+  /**
+    Register a value which has been serialized at the end of the
+    scratch buffer, starting at position @a pos.
+  */
+  bool seeing_value(char type, size_t pos) {
+    Pending_value entry;
+    entry.m_key_offset = m_key_offset;
+    entry.m_key_length = m_key_length;
+    entry.m_value_offset = pos;
+    entry.m_value_length = m_scratch.length() - pos;
+    entry.m_type = type;
+    return !m_entries.push_back(entry) || raised_error();
+  }
+
+  bool start_container(bool is_object) {
+    if (check_json_depth(m_frames.size() + 1)) return false;
+    Open_container frame;
+    frame.m_is_object = is_object;
+    frame.m_first_entry = m_entries.size();
+    frame.m_scratch_start = m_scratch.length();
+    frame.m_keys_start = m_keys.length();
+    frame.m_key_offset = m_key_offset;
+    frame.m_key_length = m_key_length;
+    return !m_frames.push_back(frame) || raised_error();
+  }
+
+  /**
+    Get the inlined representation of a value, if it can be inlined in
+    its value entry.
+
+    @param[in]  entry  the value
+    @param[in]  large  true if the large storage format is used
+    @param[out] inlined_val  the value to store in the value entry
+    @return true if the value can be inlined, false otherwise
+  */
+  bool inlined_value(const Pending_value &entry, bool large,
+                     int32 *inlined_val) const {
+    if (!inlined_type(entry.m_type, large)) return false;
+    const char *data = m_scratch.ptr() + entry.m_value_offset;
+    switch (entry.m_type) {
+      case JSONB_TYPE_LITERAL:
+        *inlined_val = static_cast<uchar>(*data);
+        break;
+      case JSONB_TYPE_INT16:
+        *inlined_val = sint2korr(data);
+        break;
+      case JSONB_TYPE_UINT16:
+        *inlined_val = uint2korr(data);
+        break;
+      case JSONB_TYPE_INT32:
+        *inlined_val = sint4korr(data);
+        break;
+      case JSONB_TYPE_UINT32:
+        *inlined_val = static_cast<int32>(uint4korr(data));
+        break;
+      default:
+        /* purecov: begin deadcode */
+        DBUG_ASSERT(false);
+        return false;
+        /* purecov: end */
+    }
+    return true;
+  }
+
+  /**
+    Calculate the size in bytes of the container which is being closed,
+    if it is written in the given storage format.
+  */
+  size_t container_size(const Open_container &frame, bool large) const {
+    const size_t count = m_order.size();
+    size_t bytes = 2 * offset_size(large) + count * value_entry_size(large);
+    if (frame.m_is_object) bytes += count * key_entry_size(large);
+    int32 unused;
+    for (size_t idx : m_order) {
+      const Pending_value &entry = m_entries[idx];
+      if (frame.m_is_object) bytes += entry.m_key_length;
+      if (!inlined_value(entry, large, &unused)) bytes += entry.m_value_length;
+    }
+    return bytes;
+  }
+
+  /**
+    Sort the members of the object which is being closed on key, and
+    remove duplicate keys. As in Json_object::add_alias(), the last
+    member with a given key wins.
+  */
+  void sort_members() {
+    const char *keys = m_keys.ptr();
+    const auto key_less = [this, keys](size_t a, size_t b) {
+      const Pending_value &ea = m_entries[a];
+      const Pending_value &eb = m_entries[b];
+      if (ea.m_key_length != eb.m_key_length)
+        return ea.m_key_length < eb.m_key_length;
+      return memcmp(keys + ea.m_key_offset, keys + eb.m_key_offset,
+                    ea.m_key_length) < 0;
+    };
+    std::stable_sort(m_order.begin(), m_order.end(), key_less);
+
+    // Keep only the last of each run of equal keys.
+    size_t kept = 0;
+    for (size_t i = 0; i < m_order.size(); ++i) {
+      if (i + 1 < m_order.size() && !key_less(m_order[i], m_order[i + 1]))
+        continue;
+      m_order[kept++] = m_order[i];
+    }
+    m_order.resize(kept);
+  }
+
+  /**
+    Write the container which is being closed, in the given storage
+    format, to m_container.
+  */
+  bool write_container(const Open_container &frame, bool large,
+                       size_t bytes) {
+    const size_t count = m_order.size();
+    const auto entry_size = value_entry_size(large);
+
+    m_container.length(0);
+    if (reserve(&m_container, bytes) ||
+        append_offset_or_size(&m_container, count, large) ||
+        append_offset_or_size(&m_container, bytes, large))
+      return true; /* purecov: inspected */
+
+    size_t offset = 2 * offset_size(large) + count * entry_size;
+    if (frame.m_is_object) {
+      offset += count * key_entry_size(large);
+      for (size_t idx : m_order) {
+        const Pending_value &entry = m_entries[idx];
+        if (append_offset_or_size(&m_container, offset, large) ||
+            append_int16(&m_container, static_cast<int16>(entry.m_key_length)))
+          return true; /* purecov: inspected */
+        offset += entry.m_key_length;
+      }
+    }
+
+    // The value entries.
+    for (size_t idx : m_order) {
+      const Pending_value &entry = m_entries[idx];
+      const size_t pos = m_container.length();
+      int32 inlined_val;
+      if (m_container.fill(pos + entry_size, 0))
+        return true; /* purecov: inspected */
+      m_container[pos] = entry.m_type;
+      if (inlined_value(entry, large, &inlined_val)) {
+        write_offset_or_size(m_container.ptr() + pos + 1, inlined_val, large);
+      } else {
+        write_offset_or_size(m_container.ptr() + pos + 1, offset, large);
+        offset += entry.m_value_length;
+      }
+    }
+
+    // The member names.
+    if (frame.m_is_object) {
+      for (size_t idx : m_order) {
+        const Pending_value &entry = m_entries[idx];
+        if (m_container.append(m_keys.ptr() + entry.m_key_offset,
+                               entry.m_key_length))
+          return true; /* purecov: inspected */
+      }
+    }
+
+    // The values that could not be inlined.
+    int32 unused;
+    for (size_t idx : m_order) {
+      const Pending_value &entry = m_entries[idx];
+      if (!inlined_value(entry, large, &unused) &&
+          m_container.append(m_scratch.ptr() + entry.m_value_offset,
+                             entry.m_value_length))
+        return true; /* purecov: inspected */
+    }
+
+    DBUG_ASSERT(m_container.length() == bytes);
+    return false;
+  }
+
+  bool end_container() {
+    DBUG_ASSERT(!m_frames.empty());
+    const Open_container frame = m_frames.back();
+    m_frames.pop_back();
+
+    m_order.clear();
+    for (size_t i = frame.m_first_entry; i < m_entries.size(); ++i)
+      if (m_order.push_back(i)) return raised_error(); /* purecov: inspected */
+    if (frame.m_is_object) sort_members();
+
+    // Use the small storage format if the container fits in it.
+    bool large = false;
+    size_t bytes = container_size(frame, large);
+    if (m_order.size() > UINT_MAX16 || bytes > UINT_MAX16) {
+      large = true;
+      bytes = container_size(frame, large);
+      if (check_document_size(bytes)) return raised_error();
+    }
+
+    if (write_container(frame, large, bytes))
+      return raised_error(); /* purecov: inspected */
+
+    // Replace the elements with the finished container.
+    m_entries.resize(frame.m_first_entry);
+    m_keys.length(frame.m_keys_start);
+    m_scratch.length(frame.m_scratch_start);
+    if (m_scratch.append(m_container.ptr(), m_container.length()))
+      return raised_error(); /* purecov: inspected */
+
+    if (m_scratch.length() > m_thd->variables.max_allowed_packet) {
+      my_error(ER_WARN_ALLOWED_PACKET_OVERFLOWED, MYF(0),
+               "json_binary::serialize", m_thd->variables.max_allowed_packet);
+      return raised_error();
+    }
+
+    m_key_offset = frame.m_key_offset;
+    m_key_length = frame.m_key_length;
+    char type;
+    if (frame.m_is_object)
+      type = large ? JSONB_TYPE_LARGE_OBJECT : JSONB_TYPE_SMALL_OBJECT;
+    else
+      type = large ? JSONB_TYPE_LARGE_ARRAY : JSONB_TYPE_SMALL_ARRAY;
+    return seeing_value(type, frame.m_scratch_start);
+  }
+
+  const THD *m_thd;
+  /// Serialized elements of the open containers.
+  StringBuffer<STRING_BUFFER_USUAL_SIZE> m_scratch;
+  /// Member names of the open objects.
+  StringBuffer<STRING_BUFFER_USUAL_SIZE> m_keys;
+  /// Work area where a container is written when it is closed.
+  StringBuffer<STRING_BUFFER_USUAL_SIZE> m_container;
+  /// Elements of the open containers, innermost last.
+  Prealloced_array<Pending_value, 16> m_entries;
+  /// Stack of open containers, innermost last.
+  Prealloced_array<Open_container, 8> m_frames;
+  /// The elements of the container being closed, in storage order.
+  Prealloced_array<size_t, 16> m_order;
+  /// The name of the next object member.
+  size_t m_key_offset{0};
+  size_t m_key_length{0};
+  bool m_error_raised;
+};
+
+bool serialize_text(const THD *thd, const char *text, size_t length,
+                    String *dest, const char **syntaxerr, size_t *offset) {
+  Binary_serializing_handler handler(thd);
+  rapidjson::MemoryStream ss(text, length);
+  rapidjson::Reader reader;
+  if (reader.Parse<rapidjson::kParseDefaultFlags>(ss, handler))
+    return handler.get_binary(dest);
+
+  if (handler.error_raised()) {
+    // Not a syntax error. The error has already been reported.
+    if (syntaxerr != nullptr) *syntaxerr = nullptr;
+    return true;
+  }
+
+  // Report the error offset and the error message if requested by the caller.
+  if (offset != nullptr) *offset = reader.GetErrorOffset();
+  if (syntaxerr != nullptr)
+    *syntaxerr = rapidjson::GetParseError_En(reader.GetParseErrorCode());
+
+  return true;
+}
 #endif  // ifdef MYSQL_SERVER
 
 bool Value::is_valid() const {
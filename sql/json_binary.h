@@ -168,6 +168,29 @@ namespace json_binary {
 */
 #ifdef MYSQL_SERVER
 bool serialize(const THD *thd, const Json_dom *dom, String *dest);
+
+/**
+  Parse a JSON text and serialize it to binary format in the destination
+  string, replacing any content already in the destination string. The
+  result is the same as parsing the text with Json_dom::parse() and
+  serializing the DOM with serialize(), but no DOM is built, and the
+  text is processed in a single pass.
+
+  @param[in]     thd        THD handle
+  @param[in]     text       the JSON text, in utf8mb4
+  @param[in]     length     the length of the text, in bytes
+  @param[in,out] dest       the destination string
+  @param[out]    syntaxerr  if not null, set to the syntax error message if
+                            the text is not valid JSON, or to null if
+                            the text could not be serialized for some
+                            other reason, which has already been reported
+  @param[out]    offset     if not null, set to the position of the
+                            syntax error in the text
+  @retval false on success
+  @retval true if an error occurred
+*/
+bool serialize_text(const THD *thd, const char *text, size_t length,
+                    String *dest, const char **syntaxerr, size_t *offset);
 #endif
 
 /**
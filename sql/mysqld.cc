@@ -789,6 +789,7 @@
 #include "sql/sd_notify.h"  // sd_notify_connect
 #include "sql/session_tracker.h"
 #include "sql/set_var.h"
+#include "sql/sp_cache.h"   // sp_cache_init
 #include "sql/sp_head.h"    // init_sp_psi_keys
 #include "sql/sql_audit.h"  // mysql_audit_general
 #include "sql/sql_base.h"
@@ -2419,6 +2420,7 @@ static void clean_up(bool print_message) {
   hostname_cache_free();
   range_optimizer_free();
   item_func_sleep_free();
+  sp_cache_free_released();
   lex_free(); /* Free some memory */
   item_create_cleanup();
   if (!opt_noacl) udf_unload_udfs();
@@ -2472,6 +2474,7 @@ static void clean_up(bool print_message) {
   mysql_client_plugin_deinit();
 
   Global_THD_manager::destroy_instance();
+  sp_cache_end();  // after all THDs are gone
 
   my_free(const_cast<char *>(log_bin_basename));
   my_free(const_cast<char *>(log_bin_index));
@@ -5593,6 +5596,7 @@ static int init_server_components() {
   randominit(&sql_rand, (ulong)server_start_time, (ulong)server_start_time / 2);
   setup_fpu();
   init_slave_list();
+  sp_cache_init();
 
   setup_error_log();  // opens the log if needed
 
@@ -8777,6 +8781,23 @@ static int show_table_definitions(THD *, SHOW_VAR *var, char *buff) {
   return 0;
 }
 
+static int show_dd_table_cache_hits(THD *, SHOW_VAR *var, char *buff) {
+  ulonglong misses;
+  var->type = SHOW_LONGLONG;
+  var->value = buff;
+  dd::get_table_cache_statistics(reinterpret_cast<ulonglong *>(buff),
+                                 &misses);
+  return 0;
+}
+
+static int show_dd_table_cache_misses(THD *, SHOW_VAR *var, char *buff) {
+  ulonglong hits;
+  var->type = SHOW_LONGLONG;
+  var->value = buff;
+  dd::get_table_cache_statistics(&hits, reinterpret_cast<ulonglong *>(buff));
+  return 0;
+}
+
 /*
    Functions relying on SSL
    Note: In the show_ssl_* functions, we need to check if we have a
@@ -8947,6 +8968,10 @@ SHOW_VAR status_vars[] = {
      SHOW_LONG_NOFLUSH, SHOW_SCOPE_GLOBAL},
     {"Delayed_writes", (char *)&delayed_insert_writes, SHOW_LONG,
      SHOW_SCOPE_GLOBAL},
+    {"Dictionary_table_cache_hits", (char *)&show_dd_table_cache_hits,
+     SHOW_FUNC, SHOW_SCOPE_GLOBAL},
+    {"Dictionary_table_cache_misses", (char *)&show_dd_table_cache_misses,
+     SHOW_FUNC, SHOW_SCOPE_GLOBAL},
     {"Error_log_buffered_bytes", (char *)&log_sink_pfs_buffered_bytes,
      SHOW_LONG_NOFLUSH, SHOW_SCOPE_GLOBAL},
     {"Error_log_buffered_events", (char *)&log_sink_pfs_buffered_events,
@@ -144,6 +144,7 @@ PSI_memory_key key_memory_user_conn;
 PSI_memory_key key_memory_user_var_entry;
 PSI_memory_key key_memory_user_var_entry_value;
 PSI_memory_key key_memory_sp_cache;
+PSI_memory_key key_memory_sp_cache_pool;
 PSI_memory_key key_memory_write_set_extraction;
 
 #ifdef HAVE_PSI_INTERFACE
@@ -175,6 +176,8 @@ static PSI_memory_info all_server_memory[] = {
     {&key_memory_prepared_statement_main_mem_root,
      "Prepared_statement::main_mem_root", PSI_FLAG_THREAD, 0, PSI_DOCUMENT_ME},
     {&key_memory_sp_cache, "THD::sp_cache", 0, 0, PSI_DOCUMENT_ME},
+    {&key_memory_sp_cache_pool, "sp_cache_pool", PSI_FLAG_ONLY_GLOBAL_STAT, 0,
+     PSI_DOCUMENT_ME},
     {&key_memory_sp_head_main_root, "sp_head::main_mem_root", 0, 0,
      PSI_DOCUMENT_ME},
     {&key_memory_sp_head_execute_root, "sp_head::execute_mem_root",
@@ -168,6 +168,7 @@ extern PSI_memory_key key_memory_user_conn;
 extern PSI_memory_key key_memory_user_var_entry;
 extern PSI_memory_key key_memory_user_var_entry_value;
 extern PSI_memory_key key_memory_sp_cache;
+extern PSI_memory_key key_memory_sp_cache_pool;
 extern PSI_memory_key key_memory_write_set_extraction;
 
 #endif  // PSI_MEMORY_KEY_INCLUDED
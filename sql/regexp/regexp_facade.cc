@@ -22,6 +22,8 @@
 
 #include "sql/regexp/regexp_facade.h"
 
+#include <string.h>
+#include <algorithm>
 #include <string>
 #include <tuple>
 
@@ -58,12 +60,32 @@ static const CHARSET_INFO *faux_binary_charset = &my_charset_latin1;
 
   @return false on success, true on error.
 */
+static bool ConvertToLibCharset(Item *expr, String *s, String *aligned_str,
+                                std::u16string *out, int skip);
+
 static bool EvalExprToCharset(Item *expr, std::u16string *out, int skip = 0) {
   alignas(sizeof(UChar)) char aligned_buff[MAX_FIELD_WIDTH];
   String aligned_str(aligned_buff, sizeof(aligned_buff), &my_charset_bin);
   String *s = expr->val_str(&aligned_str);
   if (s == nullptr) return true;
+  return ConvertToLibCharset(expr, s, &aligned_str, out, skip);
+}
+
+/**
+  Performs the character set conversion part of EvalExprToCharset(), for a
+  string that is already evaluated.
+
+  @param expr The expression that was evaluated.
+  @param s The value of the expression.
+  @param aligned_str The buffer passed to val_str(), which is suitably
+  aligned for UChar.
+  @param[out] out Will be cleared, and the result stored.
+  @param skip This number of code points will be exempted from conversion.
 
+  @return false on success, true on error.
+*/
+static bool ConvertToLibCharset(Item *expr, String *s, String *aligned_str,
+                                std::u16string *out, int skip) {
   if (s->length() == 0) {
     out->clear();
     return false;
@@ -106,9 +128,9 @@ static bool EvalExprToCharset(Item *expr, std::u16string *out, int skip = 0) {
   // However: val_str() may ignore the input argument,
   // and return a pointer to some other buffer.
   if (!is_aligned_to(s->ptr(), alignof(UChar))) {
-    DBUG_ASSERT(s != &aligned_str);
-    aligned_str.copy(*s);
-    s = &aligned_str;
+    DBUG_ASSERT(s != aligned_str);
+    aligned_str->copy(*s);
+    s = aligned_str;
   }
   out->clear();
   out->insert(out->end(), pointer_cast<const UChar *>(s->ptr()),
@@ -164,6 +186,23 @@ Mysql::Nullable<bool> Regexp_facade::Matches(Item *subject_expr, int start,
                                              int occurrence) {
   DBUG_TRACE;
 
+  if (m_engine != nullptr && m_is_literal && start == 1 && occurrence <= 1) {
+    alignas(sizeof(UChar)) char aligned_buff[MAX_FIELD_WIDTH];
+    String aligned_str(aligned_buff, sizeof(aligned_buff), &my_charset_bin);
+    String *s = subject_expr->val_str(&aligned_str);
+    if (s == nullptr) return Mysql::Nullable<bool>();
+
+    bool found;
+    if (!MatchLiteral(*s, &found)) return found;
+
+    // No luck, hand the already evaluated subject over to ICU.
+    if (ConvertToLibCharset(subject_expr, s, &aligned_str, &m_current_subject,
+                            0))
+      return Mysql::Nullable<bool>();
+    m_engine->Reset(m_current_subject);
+    return m_engine->Matches(0, occurrence);
+  }
+
   if (Reset(subject_expr, start)) return Mysql::Nullable<bool>();
 
   /*
@@ -175,9 +214,9 @@ Mysql::Nullable<bool> Regexp_facade::Matches(Item *subject_expr, int start,
 
 Mysql::Nullable<int> Regexp_facade::Find(Item *subject_expr, int start,
                                          int occurrence, bool after_match) {
-  Nullable<bool> match_found = Matches(subject_expr, start, occurrence);
-  if (!match_found.has_value()) return Mysql::Nullable<int>();
-  if (!match_found.value()) return 0;
+  // The position of the match is needed, so don't try MatchLiteral() here.
+  if (Reset(subject_expr, start)) return Mysql::Nullable<int>();
+  if (!m_engine->Matches(0, occurrence)) return 0;
   int native_start =
       after_match ? m_engine->EndOfMatch() : m_engine->StartOfMatch();
   return ConvertLibPositionToCodePoint(native_start) + start;
@@ -251,13 +290,151 @@ bool Regexp_facade::SetupEngine(Item *pattern_expr, uint flags) {
     return false;
   }
 
+  const bool keep_current = m_engine != nullptr && !m_engine->IsError();
+  if (keep_current && flags == m_engine->flags() &&
+      pattern == m_current_pattern)
+    return false;
+
+  /*
+    Look the pattern up before the current expression is added, so that it
+    isn't evicted by it when it's the least recently used one.
+  */
+  unique_ptr_destroy_only<Regexp_engine> cached_engine;
+  auto it = std::find_if(m_engine_cache.begin(), m_engine_cache.end(),
+                         [&](const Compiled_pattern &compiled) {
+                           return compiled.flags == flags &&
+                                  compiled.pattern == pattern;
+                         });
+  if (it != m_engine_cache.end()) {
+    cached_engine = std::move(it->engine);
+    m_engine_cache.erase(it);
+  }
+
+  if (keep_current) {
+    // Keep the current expression around, the pattern may come back.
+    const uint32_t current_flags = m_engine->flags();
+    m_engine_cache.insert(m_engine_cache.begin(),
+                          Compiled_pattern{std::move(m_current_pattern),
+                                           current_flags, std::move(m_engine)});
+    if (m_engine_cache.size() > ENGINE_CACHE_SIZE) m_engine_cache.pop_back();
+  }
+
+  if (cached_engine != nullptr) {
+    m_engine = std::move(cached_engine);
+    m_current_pattern = std::move(pattern);
+    SetupLiteral(flags);
+    return false;
+  }
+
   // Actually compile the regular expression.
   m_engine = make_unique_destroy_only<Regexp_engine>(
       *THR_MALLOC, pattern, flags, opt_regexp_stack_limit,
       opt_regexp_time_limit);
+  m_current_pattern = std::move(pattern);
 
   // If something went wrong, an error was raised.
-  return m_engine->IsError();
+  if (m_engine->IsError()) return true;
+
+  SetupLiteral(flags);
+  return false;
+}
+
+void Regexp_facade::SetupLiteral(uint flags) {
+  m_is_literal = false;
+  m_literal_is_anchored = false;
+  m_literal_is_case_insensitive = (flags & UREGEX_CASE_INSENSITIVE) != 0;
+  m_literal_charset = nullptr;
+
+  size_t pos = 0;
+  if (!m_current_pattern.empty() && m_current_pattern[0] == u'^') {
+    // In multi-line mode, ^ also matches after any line terminator.
+    if ((flags & UREGEX_MULTILINE) != 0) return;
+    m_literal_is_anchored = true;
+    pos = 1;
+  }
+  if (pos == m_current_pattern.size()) return;
+
+  for (; pos < m_current_pattern.size(); ++pos) {
+    const char16_t c = m_current_pattern[pos];
+    if (c >= 0x80) {
+      // Case folding of non-ASCII characters is left to ICU.
+      if (m_literal_is_case_insensitive) return;
+    } else if (c == 0 || strchr("\\^$.|?*+()[]{}", c) != nullptr) {
+      return;
+    }
+  }
+  m_is_literal = true;
+}
+
+bool Regexp_facade::MatchLiteral(const String &subject, bool *found) {
+  const CHARSET_INFO *cs = subject.charset() == &my_charset_bin
+                               ? faux_binary_charset
+                               : subject.charset();
+  /*
+    A byte-wise search finds exactly the same matches as a search on code
+    points in these character sets. This is not the case for e.g. sjis,
+    where the second byte of a character can look like an ASCII character.
+  */
+  const bool is_utf8 = my_charset_same(cs, &my_charset_utf8mb4_bin) ||
+                       my_charset_same(cs, &my_charset_utf8_bin);
+  if (!is_utf8 && !my_charset_same(cs, &my_charset_latin1)) return true;
+
+  if (cs != m_literal_charset) {
+    // Convert the literal to the subject's character set, once.
+    const size_t skip = m_literal_is_anchored ? 1 : 0;
+    m_literal.resize((m_current_pattern.size() - skip) * cs->mbmaxlen);
+    uint errors;
+    size_t length = my_convert(
+        &m_literal[0], m_literal.size(), cs,
+        pointer_cast<const char *>(m_current_pattern.data() + skip),
+        (m_current_pattern.size() - skip) * sizeof(UChar), regexp_lib_charset,
+        &errors);
+    if (errors > 0) {
+      m_is_literal = false;
+      return true;
+    }
+    m_literal.resize(length);
+    m_literal_charset = cs;
+  }
+
+  const char *begin = subject.ptr();
+  const char *end = begin + subject.length();
+  if (is_utf8) {
+    // Let ICU conversion deal with malformed strings.
+    int error = 0;
+    cs->cset->well_formed_len(cs, begin, end, subject.length(), &error);
+    if (error != 0) return true;
+  }
+
+  if (!m_literal_is_case_insensitive) {
+    if (m_literal_is_anchored)
+      *found = subject.length() >= m_literal.size() &&
+               std::equal(m_literal.begin(), m_literal.end(), begin);
+    else
+      *found = std::search(begin, end, m_literal.begin(), m_literal.end()) !=
+               end;
+    return false;
+  }
+
+  /*
+    The literal is ASCII, see SetupLiteral(). Some non-ASCII characters
+    fold to ASCII ones, e.g. KELVIN SIGN, so the subject has to be ASCII
+    too for simple case folding to give the same result as ICU.
+  */
+  if (std::any_of(begin, end, [](char c) { return (c & 0x80) != 0; }))
+    return true;
+
+  auto equal_ci = [](char a, char b) {
+    return a == b ||
+           ((a | 0x20) == (b | 0x20) && (a | 0x20) >= 'a' && (a | 0x20) <= 'z');
+  };
+  if (m_literal_is_anchored)
+    *found = subject.length() >= m_literal.size() &&
+             std::equal(m_literal.begin(), m_literal.end(), begin, equal_ci);
+  else
+    *found = std::search(begin, end, m_literal.begin(), m_literal.end(),
+                         equal_ci) != end;
+  return false;
 }
 
 }  // namespace regexp
@@ -32,6 +32,7 @@
 #include <stdint.h>
 
 #include <string>
+#include <vector>
 
 #include "nullable.h"
 #include "sql/item.h"
@@ -41,6 +42,10 @@
 extern int32_t opt_regexp_time_limit;
 extern int32_t opt_regexp_stack_limit;
 
+namespace regexp_facade_unittest {
+class CachingRegexpFacade;
+}
+
 namespace regexp {
 
 /**
@@ -50,7 +55,12 @@ namespace regexp {
     converted strings during matching.
 
   - Re-compilation of the regular expression in case the pattern is a field
-    reference or otherwise non-constant.
+    reference or otherwise non-constant. The most recently used compiled
+    expressions are kept, so that a non-constant pattern that repeats a
+    previous value doesn't have to be compiled again.
+
+  - Matching of plain literal patterns directly on the subject string,
+    without conversion to the regexp library's character set.
 
   - `NULL` handling.
 
@@ -123,9 +133,27 @@ class Regexp_facade {
   String *Substr(Item *subject_expr, int start, int occurrence, String *result);
 
   /// Delete the "engine" data structure after execution.
-  void cleanup() { m_engine = nullptr; }
+  void cleanup() {
+    m_engine = nullptr;
+    m_engine_cache.clear();
+  }
+
+  friend class regexp_facade_unittest::CachingRegexpFacade;
 
  private:
+  /**
+    A compiled regular expression, along with the pattern and flags it was
+    compiled from.
+  */
+  struct Compiled_pattern {
+    std::u16string pattern;
+    uint32_t flags;
+    unique_ptr_destroy_only<Regexp_engine> engine;
+  };
+
+  /// The number of compiled expressions kept in m_engine_cache.
+  static constexpr size_t ENGINE_CACHE_SIZE = 8;
+
   /**
     Resets the compiled regular expression with a new string.
 
@@ -139,10 +167,31 @@ class Regexp_facade {
   bool Reset(Item *subject_expr, int start = 1);
 
   /**
-    Actually compiles the regular expression.
+    Actually compiles the regular expression, unless it's found in
+    m_engine_cache.
   */
   bool SetupEngine(Item *pattern_expr, uint flags);
 
+  /**
+    Sets up m_literal if the current pattern is a plain literal, optionally
+    anchored to the start of the subject, which can be searched for in the
+    subject's own character set.
+  */
+  void SetupLiteral(uint flags);
+
+  /**
+    Tries to match the subject against the literal pattern without
+    converting it to the regexp library's character set.
+
+    @param subject The evaluated subject string.
+    @param[out] found Whether the literal was found.
+
+    @retval false The subject was searched, and `found` holds the result.
+    @retval true The subject can't be searched byte-wise, and has to be
+    matched by the regexp library.
+  */
+  bool MatchLiteral(const String &subject, bool *found);
+
   /**
     Converts a string position in m_current_subject.
     @param position One-based code point position.
@@ -179,6 +228,30 @@ class Regexp_facade {
   */
   unique_ptr_destroy_only<Regexp_engine> m_engine;
 
+  /// The pattern m_engine was compiled from, in the library's character set.
+  std::u16string m_current_pattern;
+
+  /**
+    Previously compiled regular expressions, most recently used first. Only
+    used for non-constant patterns. m_engine is never in this list.
+  */
+  std::vector<Compiled_pattern> m_engine_cache;
+
+  /// True if the current pattern is a plain literal, see SetupLiteral().
+  bool m_is_literal = false;
+
+  /// True if the literal is anchored to the start of the subject.
+  bool m_literal_is_anchored = false;
+
+  /// True if the literal is matched case insensitively.
+  bool m_literal_is_case_insensitive = false;
+
+  /// The literal, in the character set m_literal_charset.
+  std::string m_literal;
+
+  /// The character set of m_literal, or nullptr if not converted yet.
+  const CHARSET_INFO *m_literal_charset = nullptr;
+
   /**
     ICU does not copy the subject string, so we keep the subject buffer
     here. A call to Reset() causes it to be overwritten.
@@ -76,7 +76,7 @@
 #include "sql/protocol.h"
 #include "sql/psi_memory_key.h"  // key_memory_sp_head_main_root
 #include "sql/set_var.h"
-#include "sql/sp_cache.h"     // sp_cache_invalidate
+#include "sql/sp_cache.h"     // sp_cache_invalidate, sp_cache_reuse_released
 #include "sql/sp_head.h"      // Stored_program_creation_ctx
 #include "sql/sp_pcontext.h"  // sp_pcontext
 #include "sql/sql_class.h"
@@ -360,6 +360,10 @@ static enum_sp_return_code db_find_routine(THD *thd, enum_sp_type type,
 
   if (routine == nullptr) return SP_DOES_NOT_EXISTS;
 
+  // Reuse the routine if a thread that has ended had it parsed already.
+  *sphp = sp_cache_reuse_released(type, name, routine->last_altered(true));
+  if (*sphp != nullptr) return SP_OK;
+
   // prepare sp_chistics from the dd::routine object.
   st_sp_chistics sp_chistics;
   prepare_sp_chistics_from_dd_routine(routine, &sp_chistics);
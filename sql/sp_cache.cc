@@ -31,8 +31,16 @@
 #include "m_ctype.h"
 #include "map_helpers.h"
 #include "my_dbug.h"
+#include "my_sys.h"
+#include "mysql/psi/mysql_mutex.h"
+#include "sql/mysqld.h"  // stored_program_cache_size
+#include "sql/current_thd.h"
 #include "sql/psi_memory_key.h"
 #include "sql/sp_head.h"
+#include "sql/sql_class.h"  // THD
+#include "sql/sql_lex.h"    // enum_sp_type
+
+class sp_cache_pool;
 
 /*
   Cache of stored routines.
@@ -74,6 +82,13 @@ class sp_cache {
     if (m_hashtable.size() > upper_limit_for_elements) m_hashtable.clear();
   }
 
+  /**
+    Move all elements to the pool of released routines.
+
+    @param[in] pool  Pool to move the routines to.
+  */
+  void release_to(sp_cache_pool *pool);
+
  private:
   struct sp_head_deleter {
     void operator()(sp_head *sp) const { sp_head::destroy(sp); }
@@ -87,6 +102,190 @@ class sp_cache {
 
 static std::atomic<int64> atomic_Cversion{0};
 
+/*
+  Routines released by threads that have cleared their cache, e.g. when a
+  pooled connection is reset or closed. A thread that misses a routine in
+  its own cache takes it from here instead of parsing it again.
+
+  Routines in the pool are not owned by any thread, and a routine handed
+  out by take() is owned by the thread that got it, so sp_head objects
+  are never executed concurrently. The memory of pooled routines is not
+  claimed by any thread either. The pool holds at most
+  stored_program_cache_size functions and as many procedures.
+
+  The pool is protected by LOCK_sp_cache_pool. Routines are never
+  destroyed while holding it.
+*/
+
+class sp_cache_pool {
+ public:
+  sp_cache_pool()
+      : m_functions(system_charset_info, key_memory_sp_cache_pool),
+        m_procedures(system_charset_info, key_memory_sp_cache_pool) {}
+
+  ~sp_cache_pool() {
+    destroy_all(&m_functions);
+    destroy_all(&m_procedures);
+  }
+
+  /**
+    Take over a routine from a thread cache.
+
+    Obsolete routines are refused, as are routines which keep plugins
+    locked, since they would prevent these plugins from being uninstalled
+    for as long as they stay in the pool.
+
+    @param[in] sp  Routine to take over.
+
+    @retval true   The routine is now owned by the pool.
+    @retval false  The routine was refused and must be destroyed by the
+                   caller.
+  */
+  bool release(sp_head *sp) {
+    DBUG_ASSERT(!sp->is_invoked());
+    Routine_map *routines = routines_of(sp->m_type);
+
+    if (sp->sp_cache_version() < sp_cache_version() ||
+        routines->size() >= stored_program_cache_size ||
+        sp->has_locked_plugins())
+      return false;
+
+    routines->emplace(to_string(sp->m_qname), sp);
+    sp->claim_memory_ownership(false);
+    return true;
+  }
+
+  /**
+    Hand out a routine to a thread.
+
+    @param[in] type  Type of the routine.
+    @param[in] name  Name of the routine.
+
+    @return A released copy of the routine, up to date or not, or nullptr
+    if there is none.
+  */
+  sp_head *take(enum_sp_type type, const sp_name *name) {
+    Routine_map *routines = routines_of(type);
+    auto it = routines->find(to_string(name->m_qname));
+    if (it == routines->end()) return nullptr;
+
+    sp_head *sp = it->second;
+    routines->erase(it);
+    return sp;
+  }
+
+ private:
+  typedef collation_unordered_multimap<std::string, sp_head *> Routine_map;
+
+  Routine_map *routines_of(enum_sp_type type) {
+    DBUG_ASSERT(type == enum_sp_type::FUNCTION ||
+                type == enum_sp_type::PROCEDURE);
+    return type == enum_sp_type::FUNCTION ? &m_functions : &m_procedures;
+  }
+
+  static void destroy_all(Routine_map *routines) {
+    for (const auto &key_and_value : *routines)
+      sp_head::destroy(key_and_value.second);
+    routines->clear();
+  }
+
+  /* Released stored functions */
+  Routine_map m_functions;
+  /* Released stored procedures */
+  Routine_map m_procedures;
+};  // class sp_cache_pool
+
+void sp_cache::release_to(sp_cache_pool *pool) {
+  for (auto it = m_hashtable.begin(); it != m_hashtable.end();) {
+    if (pool->release(it->second.get())) {
+      it->second.release();
+      it = m_hashtable.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+/*
+  The pool is only read and changed under LOCK_sp_cache_pool. It is also
+  atomic so that threads can skip the mutex when there is no pool, i.e.,
+  before server startup and after sp_cache_free_released().
+*/
+static std::atomic<sp_cache_pool *> released_routines{nullptr};
+static mysql_mutex_t LOCK_sp_cache_pool;
+static bool sp_cache_inited = false;
+
+#ifdef HAVE_PSI_INTERFACE
+static PSI_mutex_key key_LOCK_sp_cache_pool;
+
+static PSI_mutex_info all_sp_cache_mutexes[] = {
+    {&key_LOCK_sp_cache_pool, "LOCK_sp_cache_pool", PSI_FLAG_SINGLETON, 0,
+     PSI_DOCUMENT_ME}};
+#endif /* HAVE_PSI_INTERFACE */
+
+/**
+  Initialize the pool of released routines. Called at server startup.
+*/
+
+void sp_cache_init() {
+#ifdef HAVE_PSI_INTERFACE
+  int count = static_cast<int>(array_elements(all_sp_cache_mutexes));
+  mysql_mutex_register("sql", all_sp_cache_mutexes, count);
+#endif
+
+  mysql_mutex_init(key_LOCK_sp_cache_pool, &LOCK_sp_cache_pool,
+                   MY_MUTEX_INIT_FAST);
+  sp_cache_inited = true;
+  released_routines = new sp_cache_pool();
+}
+
+/**
+  Destroy the pool of released routines. Called at server shutdown, before
+  plugins are unloaded.
+
+  Threads that are still running, e.g. threads owned by plugins, may clear
+  their caches afterwards. Their routines are then destroyed instead of
+  being released.
+*/
+
+void sp_cache_free_released() {
+  if (released_routines == nullptr) return;
+
+  mysql_mutex_lock(&LOCK_sp_cache_pool);
+  sp_cache_pool *pool = released_routines.exchange(nullptr);
+  mysql_mutex_unlock(&LOCK_sp_cache_pool);
+
+  if (pool == nullptr) return;
+
+  /*
+    Destroying routines frees their items and LEX objects, which expects
+    a current THD. Provide a temporary one if called without.
+  */
+  THD *thd = nullptr;
+  if (current_thd == nullptr) {
+    thd = new THD;
+    thd->thread_stack = (char *)&thd;
+    thd->store_globals();
+  }
+
+  delete pool;
+
+  delete thd;
+}
+
+/**
+  Free the resources of the stored routine caches. Called at server
+  shutdown, when all threads have ended.
+*/
+
+void sp_cache_end() {
+  DBUG_ASSERT(released_routines == nullptr);
+  if (!sp_cache_inited) return;
+
+  mysql_mutex_destroy(&LOCK_sp_cache_pool);
+  sp_cache_inited = false;
+}
+
 /*
   Clear the cache *cp and set *cp to NULL.
 
@@ -95,13 +294,21 @@ static std::atomic<int64> atomic_Cversion{0};
     cp  Pointer to cache to clear
 
   NOTE
-    This function doesn't invalidate other caches.
+    This function doesn't invalidate other caches. The routines of the
+    cache are moved to the pool of released routines, if there is one.
 */
 
 void sp_cache_clear(sp_cache **cp) {
   sp_cache *c = *cp;
 
   if (c) {
+    if (released_routines != nullptr) {
+      mysql_mutex_lock(&LOCK_sp_cache_pool);
+      sp_cache_pool *pool = released_routines;
+      if (pool != nullptr) c->release_to(pool);
+      mysql_mutex_unlock(&LOCK_sp_cache_pool);
+    }
+    /* Destroys the routines the pool did not take, outside the lock. */
     delete c;
     *cp = nullptr;
   }
@@ -208,3 +415,42 @@ int64 sp_cache_version() { return atomic_Cversion; }
 void sp_cache_enforce_limit(sp_cache *c, ulong upper_limit_for_elements) {
   if (c) c->enforce_limit(upper_limit_for_elements);
 }
+
+/**
+  Take a routine from the pool of released routines.
+
+  @param[in] type      Type of the routine.
+  @param[in] name      Name of the routine.
+  @param[in] modified  Last modification time of the routine in the data
+                       dictionary, see sp_head::m_modified.
+
+  @note The routine is owned by the caller, who is expected to put it
+  into its thread cache with sp_cache_insert().
+
+  @return The routine, or nullptr if no up to date copy was released.
+*/
+
+sp_head *sp_cache_reuse_released(enum_sp_type type, const sp_name *name,
+                                 longlong modified) {
+  while (released_routines != nullptr) {
+    mysql_mutex_lock(&LOCK_sp_cache_pool);
+    sp_cache_pool *pool = released_routines;
+    sp_head *sp = pool == nullptr ? nullptr : pool->take(type, name);
+    mysql_mutex_unlock(&LOCK_sp_cache_pool);
+
+    if (sp == nullptr) break;
+
+    sp->claim_memory_ownership(true);
+
+    if (sp->sp_cache_version() == sp_cache_version() &&
+        sp->m_modified == modified) {
+      DBUG_PRINT("info", ("sp_cache: reusing released %.*s: %p",
+                          (int)name->m_qname.length, name->m_qname.str, sp));
+      return sp;
+    }
+
+    /* An outdated copy, destroyed outside the lock. */
+    sp_head::destroy(sp);
+  }
+  return nullptr;
+}
@@ -33,11 +33,17 @@
    * Each thread has its own cache.
    * Each sp_head object is put into its thread cache before it is used, and
      then remains in the cache until deleted.
+   * When a thread clears its cache, the routines that are still up to date
+     and keep no plugins locked are moved to a server-wide pool of released
+     routines. A thread loading
+     a routine takes it from the pool, if there, instead of parsing it
+     again. An sp_head object is thus never shared by two threads.
 */
 
 class sp_cache;
 class sp_head;
 class sp_name;
+enum class enum_sp_type;
 
 /*
   Cache usage scenarios:
@@ -55,8 +61,15 @@ class sp_name;
 
   2. Before thread exit:
     sp_cache_clear();
+
+  3. Loading a routine from the data dictionary:
+    sp_cache_reuse_released();
 */
 
+void sp_cache_init();
+void sp_cache_free_released();
+void sp_cache_end();
+
 void sp_cache_clear(sp_cache **cp);
 void sp_cache_insert(sp_cache **cp, sp_head *sp);
 sp_head *sp_cache_lookup(sp_cache **cp, const sp_name *name);
@@ -64,5 +77,7 @@ void sp_cache_invalidate();
 void sp_cache_flush_obsolete(sp_cache **cp, sp_head **sp);
 int64 sp_cache_version();
 void sp_cache_enforce_limit(sp_cache *cp, ulong upper_limit_for_elements);
+sp_head *sp_cache_reuse_released(enum_sp_type type, const sp_name *name,
+                                 longlong modified);
 
 #endif /* _SP_CACHE_H_ */
@@ -1695,6 +1695,21 @@ void sp_head::destroy(sp_head *sp) {
   free_root(&own_root, MYF(0));
 }
 
+bool sp_head::has_locked_plugins() const {
+  for (const sp_head *sp = this; sp != nullptr; sp = sp->m_next_cached_sp) {
+    for (const sp_instr *i : sp->m_instructions)
+      if (i->has_locked_plugins()) return true;
+  }
+  return false;
+}
+
+void sp_head::claim_memory_ownership(bool claim MY_ATTRIBUTE((unused))) {
+#ifdef HAVE_PSI_MEMORY_INTERFACE
+  for (sp_head *sp = this; sp != nullptr; sp = sp->m_next_cached_sp)
+    sp->main_mem_root.Claim(claim);
+#endif /* HAVE_PSI_MEMORY_INTERFACE */
+}
+
 sp_head::sp_head(MEM_ROOT &&mem_root, enum_sp_type type)
     : m_type(type),
       m_flags(0),
@@ -1716,7 +1731,14 @@ sp_head::sp_head(MEM_ROOT &&mem_root, enum_sp_type type)
       m_sptabs(system_charset_info, key_memory_sp_head_main_root),
       m_sp_cache_version(0),
       m_creation_ctx(nullptr),
-      unsafe_flags(0) {
+      unsafe_flags(0),
+      m_trigger_ctx_mem_root(key_memory_sp_head_call_root, MEM_ROOT_BLOCK_SIZE),
+      m_trigger_ctx_item_list(nullptr),
+      m_trigger_runtime_ctx(nullptr),
+      m_trigger_ctx_thd(nullptr),
+      m_trigger_ctx_query_id(0),
+      m_trigger_ctx_grant_info(nullptr),
+      m_trigger_ctx_in_use(false) {
   m_first_instance = this;
   m_first_free_instance = this;
   m_last_cached_sp = this;
@@ -1900,6 +1922,8 @@ sp_head::~sp_head() {
   // Parsing of SP-body must have been already finished.
   DBUG_ASSERT(!m_parser_data.is_parsing_sp_body());
 
+  release_trigger_runtime_ctx();
+
   for (uint ip = 0; (i = get_instr(ip)); ip++) ::destroy(i);
 
   ::destroy(m_root_parsing_ctx);
@@ -2399,6 +2423,24 @@ done:
   return err_status;
 }
 
+void sp_head::release_trigger_runtime_ctx() {
+  DBUG_ASSERT(!m_trigger_ctx_in_use);
+
+  ::destroy(m_trigger_runtime_ctx);
+  m_trigger_runtime_ctx = nullptr;
+
+  Query_arena ctx_arena(&m_trigger_ctx_mem_root,
+                        Query_arena::STMT_INITIALIZED_FOR_SP);
+  ctx_arena.set_item_list(m_trigger_ctx_item_list);
+  ctx_arena.free_items();
+  m_trigger_ctx_item_list = nullptr;
+  free_root(&m_trigger_ctx_mem_root, MYF(0));
+
+  m_trigger_ctx_thd = nullptr;
+  m_trigger_ctx_query_id = 0;
+  m_trigger_ctx_grant_info = nullptr;
+}
+
 bool sp_head::execute_trigger(THD *thd, const LEX_CSTRING &db_name,
                               const LEX_CSTRING &table_name,
                               GRANT_INFO *grant_info) {
@@ -2407,6 +2449,8 @@ bool sp_head::execute_trigger(THD *thd, const LEX_CSTRING &db_name,
   MEM_ROOT call_mem_root;
   Query_arena call_arena(&call_mem_root, Query_arena::STMT_INITIALIZED_FOR_SP);
   Query_arena backup_arena;
+  sp_rcontext *trigger_runtime_ctx = nullptr;
+  bool reuse_ctx;
 
   DBUG_TRACE;
   DBUG_PRINT("info", ("trigger %s", m_name.str));
@@ -2426,26 +2470,44 @@ bool sp_head::execute_trigger(THD *thd, const LEX_CSTRING &db_name,
     return true;
 
   /*
-    Fetch information about table-level privileges for subject table into
-    GRANT_INFO instance. The access check itself will happen in
-    Item_trigger_field, where this information will be used along with
-    information about column-level privileges.
+    A multi-row statement invokes the trigger once per row. The runtime
+    context and the privilege check of the first invocation are reused by
+    the following ones, as long as they come from the same statement
+    (sp_head::execute() restores thd->query_id of the calling statement)
+    and the previous invocation left no handlers or cursors behind.
+    A context left over from an earlier statement is discarded.
   */
+  reuse_ctx = m_trigger_runtime_ctx != nullptr && !m_trigger_ctx_in_use &&
+              m_trigger_ctx_thd == thd &&
+              m_trigger_ctx_query_id == thd->query_id &&
+              m_trigger_ctx_grant_info == grant_info;
 
-  fill_effective_table_privileges(thd, grant_info, db_name.str, table_name.str);
+  if (!reuse_ctx && !m_trigger_ctx_in_use) release_trigger_runtime_ctx();
 
-  /* Check that the definer has TRIGGER privilege on the subject table. */
+  if (!reuse_ctx) {
+    /*
+      Fetch information about table-level privileges for subject table into
+      GRANT_INFO instance. The access check itself will happen in
+      Item_trigger_field, where this information will be used along with
+      information about column-level privileges.
+    */
 
-  if (!(grant_info->privilege & TRIGGER_ACL)) {
-    char priv_desc[128];
-    get_privilege_desc(priv_desc, sizeof(priv_desc), TRIGGER_ACL);
+    fill_effective_table_privileges(thd, grant_info, db_name.str,
+                                    table_name.str);
 
-    my_error(ER_TABLEACCESS_DENIED_ERROR, MYF(0), priv_desc,
-             thd->security_context()->priv_user().str,
-             thd->security_context()->host_or_ip().str, table_name.str);
+    /* Check that the definer has TRIGGER privilege on the subject table. */
 
-    m_security_ctx.restore_security_context(thd, save_ctx);
-    return true;
+    if (!(grant_info->privilege & TRIGGER_ACL)) {
+      char priv_desc[128];
+      get_privilege_desc(priv_desc, sizeof(priv_desc), TRIGGER_ACL);
+
+      my_error(ER_TABLEACCESS_DENIED_ERROR, MYF(0), priv_desc,
+               thd->security_context()->priv_user().str,
+               thd->security_context()->host_or_ip().str, table_name.str);
+
+      m_security_ctx.restore_security_context(thd, save_ctx);
+      return true;
+    }
   }
   /*
     Optimizer trace note: we needn't explicitly test here that the connected
@@ -2455,24 +2517,44 @@ bool sp_head::execute_trigger(THD *thd, const LEX_CSTRING &db_name,
     security context we will disable tracing.
   */
 
+  if (reuse_ctx) {
+    trigger_runtime_ctx = m_trigger_runtime_ctx;
+  } else if (!m_trigger_ctx_in_use) {
+    /*
+      Create the runtime context on a memory root which outlives this call,
+      so that the remaining rows of the statement can reuse it.
+    */
+    Query_arena ctx_arena(&m_trigger_ctx_mem_root,
+                          Query_arena::STMT_INITIALIZED_FOR_SP);
+    thd->swap_query_arena(ctx_arena, &backup_arena);
+    trigger_runtime_ctx = sp_rcontext::create(thd, m_root_parsing_ctx, nullptr);
+    thd->swap_query_arena(backup_arena, &ctx_arena);
+
+    m_trigger_ctx_item_list = ctx_arena.item_list();
+    if (trigger_runtime_ctx != nullptr) {
+      m_trigger_runtime_ctx = trigger_runtime_ctx;
+      m_trigger_ctx_thd = thd;
+      m_trigger_ctx_query_id = thd->query_id;
+      m_trigger_ctx_grant_info = grant_info;
+    } else {
+      release_trigger_runtime_ctx();
+    }
+  }
+
   /*
     Prepare arena and memroot for objects which lifetime is whole
-    duration of trigger call (sp_rcontext, it's tables and items,
-    sp_cursor and Item_cache holders for case expressions).  We can't
-    use caller's arena/memroot for those objects because in this case
-    some fixed amount of memory will be consumed for each trigger
-    invocation and so statements which involve lot of them will hog
-    memory.
-
-    TODO: we should create sp_rcontext once per command and reuse it
-    on subsequent executions of a trigger.
+    duration of trigger call (items created during execution, sp_cursor
+    and, for a nested invocation, sp_rcontext itself). We can't use
+    caller's arena/memroot for those objects because in this case some
+    fixed amount of memory will be consumed for each trigger invocation
+    and so statements which involve lot of them will hog memory.
   */
   init_sql_alloc(key_memory_sp_head_call_root, &call_mem_root,
                  MEM_ROOT_BLOCK_SIZE, 0);
   thd->swap_query_arena(call_arena, &backup_arena);
 
-  sp_rcontext *trigger_runtime_ctx =
-      sp_rcontext::create(thd, m_root_parsing_ctx, nullptr);
+  if (trigger_runtime_ctx == nullptr && m_trigger_ctx_in_use)
+    trigger_runtime_ctx = sp_rcontext::create(thd, m_root_parsing_ctx, nullptr);
 
   if (!trigger_runtime_ctx) {
     err_status = true;
@@ -2482,23 +2564,40 @@ bool sp_head::execute_trigger(THD *thd, const LEX_CSTRING &db_name,
   trigger_runtime_ctx->sp = this;
   thd->sp_runtime_ctx = trigger_runtime_ctx;
 
+  {
+    const bool owns_cached_ctx = trigger_runtime_ctx == m_trigger_runtime_ctx;
+    if (owns_cached_ctx) m_trigger_ctx_in_use = true;
+
 #ifdef HAVE_PSI_SP_INTERFACE
-  PSI_sp_locker_state psi_state;
-  PSI_sp_locker *locker;
+    PSI_sp_locker_state psi_state;
+    PSI_sp_locker *locker;
 
-  locker = MYSQL_START_SP(&psi_state, m_sp_share);
+    locker = MYSQL_START_SP(&psi_state, m_sp_share);
 #endif
-  err_status = execute(thd, false);
+    err_status = execute(thd, false);
 #ifdef HAVE_PSI_SP_INTERFACE
-  MYSQL_END_SP(locker);
+    MYSQL_END_SP(locker);
 #endif
 
+    if (owns_cached_ctx) m_trigger_ctx_in_use = false;
+  }
+
 err_with_cleanup:
   thd->swap_query_arena(backup_arena, &call_arena);
 
   m_security_ctx.restore_security_context(thd, save_ctx);
 
-  ::destroy(trigger_runtime_ctx);
+  if (trigger_runtime_ctx != m_trigger_runtime_ctx) {
+    ::destroy(trigger_runtime_ctx);
+  } else if (err_status || !trigger_runtime_ctx->can_be_reused()) {
+    release_trigger_runtime_ctx();
+  } else {
+    /*
+      The CASE expression holders were created on call_mem_root, which is
+      freed below, so they must not be seen by the next row.
+    */
+    trigger_runtime_ctx->reset_case_expr_holders();
+  }
   call_arena.free_items();
   free_root(&call_mem_root, MYF(0));
   thd->sp_runtime_ctx = parent_sp_runtime_ctx;
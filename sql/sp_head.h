@@ -67,6 +67,7 @@ class sp_instr;
 class sp_label;
 class sp_lex_branch_instr;
 class sp_pcontext;
+class sp_rcontext;
 
 /**
   Number of PSI_statement_info instruments
@@ -547,6 +548,22 @@ class sp_head {
   /// Is this routine being executed?
   bool is_invoked() const { return m_flags & IS_INVOKED; }
 
+  /**
+    Check if any instruction of this routine, or of its recursion
+    instances, keeps plugins locked. Such locks are only released when
+    the routine is destroyed.
+  */
+  bool has_locked_plugins() const;
+
+  /**
+    Claim or release the memory of this routine, and of its recursion
+    instances, for the current thread, when the routine moves between a
+    thread cache and the pool of released routines.
+
+    @param claim  true to claim ownership, false to release it.
+  */
+  void claim_memory_ownership(bool claim);
+
   /**
     Get the value of the SP cache version, as remembered
     when the routine was inserted into the cache.
@@ -594,9 +611,11 @@ class sp_head {
                              information about definer's privileges
                              on subject table
 
-    @todo
-      We should create sp_rcontext once per command and reuse it
-      on subsequent executions of a trigger.
+    @note
+      The runtime context (sp_rcontext) and the definer's privileges on
+      the subject table are set up on the first invocation within a
+      statement and reused for the remaining rows of that statement,
+      see m_trigger_runtime_ctx.
 
     @return Error status.
   */
@@ -941,7 +960,39 @@ class sp_head {
   /// Flags of LEX::enum_binlog_stmt_unsafe.
   uint32 unsafe_flags;
 
+  /**
+    Memory root holding m_trigger_runtime_ctx and its variable table.
+    Unlike the per-call memory root of execute_trigger() it survives
+    between invocations of the trigger within one statement.
+  */
+  MEM_ROOT m_trigger_ctx_mem_root;
+
+  /// Items created on m_trigger_ctx_mem_root (variable items).
+  Item *m_trigger_ctx_item_list;
+
+  /**
+    Runtime context of the trigger kept for reuse by subsequent rows of
+    the statement identified by m_trigger_ctx_thd and
+    m_trigger_ctx_query_id. NULL if there is no such context.
+  */
+  sp_rcontext *m_trigger_runtime_ctx;
+
+  /// Connection which created m_trigger_runtime_ctx.
+  const THD *m_trigger_ctx_thd;
+
+  /// Id of the statement which created m_trigger_runtime_ctx.
+  query_id_t m_trigger_ctx_query_id;
+
+  /// GRANT_INFO filled with the definer's privileges for that statement.
+  const GRANT_INFO *m_trigger_ctx_grant_info;
+
+  /// True while m_trigger_runtime_ctx is used by an active invocation.
+  bool m_trigger_ctx_in_use;
+
  private:
+  /// Destroy the runtime context cached by execute_trigger(), if any.
+  void release_trigger_runtime_ctx();
+
   /// Copy sp name from parser.
   void init_sp_name(THD *thd, sp_name *spname);
 
@@ -374,7 +374,39 @@ bool sp_lex_instr::reset_lex_and_exec_core(THD *thd, uint *nextp,
   /* Open tables if needed. */
 
   if (!error) {
-    if (open_tables) {
+    if (open_tables && can_skip_open_tables(thd)) {
+      /*
+        There is nothing to open, but mark the tables as locked like
+        lock_tables() does for an empty table list, and reset the state
+        like close_thread_tables() does.
+      */
+#ifndef DBUG_OFF
+      const bool had_stmt_trx =
+          !thd->get_transaction()->is_empty(Transaction_ctx::STMT);
+      const bool had_rollback_request = thd->transaction_rollback_request;
+      const bool had_stmt_locks = thd->mdl_context.has_locks(MDL_STATEMENT);
+#endif
+      m_lex->lock_tables_state = Query_tables_list::LTS_LOCKED;
+      m_lex->restore_cmd_properties();
+      bind_fields(m_arena.item_list());
+
+      error = exec_core(thd, nextp);
+      DBUG_PRINT("info", ("exec_core returned: %d", error));
+
+      m_lex->cleanup(thd, true);
+      m_lex->lock_tables_state = Query_tables_list::LTS_NOT_LOCKED;
+
+      /*
+        The statement commit or rollback, the handling of a rollback request
+        and the MDL release done by the regular path below have nothing to
+        do: with no tables, no engine joined the statement transaction and
+        no statement lock was taken.
+      */
+      DBUG_ASSERT(had_stmt_trx ||
+                  thd->get_transaction()->is_empty(Transaction_ctx::STMT));
+      DBUG_ASSERT(had_rollback_request || !thd->transaction_rollback_request);
+      DBUG_ASSERT(had_stmt_locks || !thd->mdl_context.has_locks(MDL_STATEMENT));
+    } else if (open_tables) {
       // todo: break this block out into a separate function.
       /*
         IF, CASE, DECLARE, SET, RETURN, have 'open_tables' true; they may
@@ -781,6 +813,18 @@ void sp_lex_instr::set_lex(LEX *lex, bool is_lex_owner) {
   if (m_lex) m_lex->sp_lex_in_use = true;
 }
 
+bool sp_lex_instr::can_skip_open_tables(const THD *thd) const {
+  /*
+    Tables used by stored functions are only known after prelocking,
+    subqueries are left to the regular path even without tables, and the
+    optimizer trace expects a trace for every such instruction.
+  */
+  return m_lex->query_tables == nullptr && !m_lex->uses_stored_routines() &&
+         m_lex_query_tables_own_last == nullptr &&
+         m_lex->select_lex->first_inner_unit() == nullptr &&
+         !(thd->variables.optimizer_trace & Opt_trace_context::FLAG_ENABLED);
+}
+
 void sp_lex_instr::free_lex() {
   if (!m_is_lex_owner || !m_lex) return;
 
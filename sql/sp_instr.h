@@ -191,6 +191,10 @@ class sp_instr : public sp_printable {
     return nullptr;
   }
 
+  /// @return true if the instruction keeps plugins locked until it is
+  /// destroyed.
+  virtual bool has_locked_plugins() const { return false; }
+
   Query_arena m_arena;
 
  protected:
@@ -268,6 +272,10 @@ class sp_lex_instr : public sp_instr {
     return &m_trig_field_list;
   }
 
+  bool has_locked_plugins() const override {
+    return m_lex != nullptr && !m_lex->plugins.empty();
+  }
+
  private:
   /**
     Prepare LEX and thread for execution of instruction, if requested open
@@ -289,6 +297,19 @@ class sp_lex_instr : public sp_instr {
   */
   bool reset_lex_and_exec_core(THD *thd, uint *nextp, bool open_tables);
 
+  /**
+    Check if an instruction that calculates an expression can skip opening
+    and locking tables, and the statement commit and table close that go
+    with it. That is the case when the expression refers to no tables and
+    no stored functions, e.g. in SET i = i + 1 or WHILE i < n, which lets
+    such loops run without the overhead of a statement per iteration.
+
+    @param thd  Thread context.
+
+    @return true if opening tables can be skipped, false otherwise.
+  */
+  bool can_skip_open_tables(const THD *thd) const;
+
   /**
     (Re-)parse the query corresponding to this instruction and return a new
     LEX-object.
@@ -266,6 +266,13 @@ class sp_rcontext {
 
   void pop_all_cursors() { pop_cursors(m_ccount); }
 
+  /// @return true if no handlers or cursors are left over from a previous
+  /// execution, so this context can be used to execute the program again.
+  bool can_be_reused() const {
+    return m_visible_handlers.empty() && m_activated_handlers.empty() &&
+           m_ccount == 0;
+  }
+
   sp_cursor *get_cursor(uint i) const { return m_cstack[i]; }
 
   /////////////////////////////////////////////////////////////////////////
@@ -307,6 +314,14 @@ class sp_rcontext {
     return (Item **)m_case_expr_holders.array() + case_expr_id;
   }
 
+  /// Forget the CASE expression holders. They are allocated on the caller's
+  /// arena, so a context which outlives that arena must drop them before it
+  /// is used again.
+  void reset_case_expr_holders() {
+    for (size_t i = 0; i < m_case_expr_holders.size(); ++i)
+      m_case_expr_holders[i] = nullptr;
+  }
+
  private:
   /// Internal function to allocate memory for arrays.
   ///
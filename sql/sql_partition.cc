@@ -3616,12 +3616,16 @@ err:
     If start_part > end_part at return it means no partition needs to be
     scanned. If start_part == end_part it always means a single partition
     needs to be scanned.
+    Otherwise start_part is the first used partition of the range and
+    end_part is left as it is unless it can be narrowed down to start_part:
+    scans walk the used partitions with get_next_used_partition() anyway,
+    and looking for the last used one would cost a bitmap walk for every
+    index lookup on tables with many partitions.
 
   RETURN VALUE
     part_spec
 */
 void prune_partition_set(const TABLE *table, part_id_range *part_spec) {
-  int last_partition = -1;
   uint i = part_spec->start_part;
   partition_info *part_info = table->part_info;
   DBUG_TRACE;
@@ -3631,21 +3635,34 @@ void prune_partition_set(const TABLE *table, part_id_range *part_spec) {
   else
     i = bitmap_get_first_set(&part_info->read_partitions);
 
+  if (i == MY_BIT_NONE || i > part_spec->end_part) {
+    /* No partition found in pruned bitmap */
+    part_spec->start_part = part_spec->end_part + 1;
+    return;
+  }
+  DBUG_PRINT("info", ("Partition %d is set", i));
   part_spec->start_part = i;
 
-  /* TODO: Only check next bit, no need to prune end if >= 2 partitions. */
-  for (; i <= part_spec->end_part;
-       i = bitmap_get_next_set(&part_info->read_partitions, i)) {
-    DBUG_PRINT("info", ("Partition %d is set", i));
-    if (last_partition == -1)
-      /* First partition found in set and pruned bitmap */
-      part_spec->start_part = i;
-    last_partition = i;
+  /* Only check the next bit to find out if a single partition is left. */
+  if (i < part_spec->end_part) {
+    uint next = bitmap_get_next_set(&part_info->read_partitions, i);
+    if (next == MY_BIT_NONE || next > part_spec->end_part)
+      part_spec->end_part = i;
   }
-  if (last_partition == -1) /* No partition found in pruned bitmap */
-    part_spec->start_part = part_spec->end_part + 1;
-  else  // if (last_partition != -1)
-    part_spec->end_part = last_partition;
+}
+
+/**
+  Check whether all rows returned by an index read starting with the given
+  key have the same values as the key for all key parts it covers.
+
+  Such reads (ref access, ref access in reverse order, equality ranges)
+  can be limited to the partitions matching the key value, as long as the
+  key binds the partitioning function.
+*/
+static inline bool key_read_is_prefix_equality(const key_range *key_spec) {
+  return key_spec->flag == HA_READ_KEY_EXACT ||
+         key_spec->flag == HA_READ_PREFIX ||
+         key_spec->flag == HA_READ_PREFIX_LAST;
 }
 
 /*
@@ -3663,6 +3680,9 @@ void prune_partition_set(const TABLE *table, part_id_range *part_spec) {
   DESCRIPTION
     This function is called to discover which partitions to use in an index
     scan or a full table scan.
+    It is called for every index lookup, so partitions are pruned using the
+    actual key values, also those only known at execution time (e.g. the
+    values of a ref access on the inner table of a join).
     It returns a range of partitions to scan. If there are holes in this
     range with partitions that are not needed to scan a bit array is used
     to signal which partitions to use and which not to use.
@@ -3686,8 +3706,7 @@ void get_partition_set(const TABLE *table, uchar *buf, const uint index,
 
   part_spec->start_part = 0;
   part_spec->end_part = num_parts - 1;
-  if ((index < MAX_KEY) && key_spec &&
-      key_spec->flag == (uint)HA_READ_KEY_EXACT &&
+  if ((index < MAX_KEY) && key_spec && key_read_is_prefix_equality(key_spec) &&
       part_info->some_fields_in_PF.is_set(index)) {
     key_info = table->key_info + index;
     /*
@@ -43,6 +43,8 @@ std::unique_ptr<Stream_cipher> Aes_ctr::get_decryptor() {
 template <Cipher_type TYPE>
 bool Aes_ctr_cipher<TYPE>::open(const Key_string &password, int header_size) {
   m_header_size = header_size;
+  /* A new password needs a new key schedule */
+  deinit_cipher();
 #ifdef HAVE_BYTESTOKEY_SHA512_HANDLING
   if (EVP_BytesToKey(Aes_ctr::get_evp_cipher(), Aes_ctr::get_evp_md(), nullptr,
                      password.data(), password.length(), 1, m_file_key,
@@ -83,7 +85,6 @@ bool Aes_ctr_cipher<TYPE>::set_stream_offset(uint64_t offset) {
   /* A seek in the down stream would overflow the offset */
   if (offset > UINT64_MAX - m_header_size) return true;
 
-  deinit_cipher();
   if (init_cipher(offset)) return true;
   /*
     The cipher works with blocks. While init_cipher() above is called it will
@@ -105,10 +106,6 @@ bool Aes_ctr_cipher<TYPE>::init_cipher(uint64_t offset) {
 
   uint64_t counter = offset / AES_BLOCK_SIZE;
 
-  DBUG_ASSERT(m_ctx == nullptr);
-  m_ctx = EVP_CIPHER_CTX_new();
-  if (m_ctx == nullptr) return true;
-
   /*
     AES's IV is 16 bytes.
     In CTR mode, we will use the last 8 bytes as the counter.
@@ -122,11 +119,22 @@ bool Aes_ctr_cipher<TYPE>::init_cipher(uint64_t offset) {
   std::swap(m_iv[11], m_iv[12]);
 
   int res;
-  const EVP_CIPHER *cipher_type = Aes_ctr::get_evp_cipher();
 
-  /* EVP_CipherInit() returns 1 for success and 0 for failure */
-  res = EVP_CipherInit(m_ctx, cipher_type, m_file_key, m_iv,
-                       static_cast<int>(TYPE));
+  if (m_ctx == nullptr) {
+    m_ctx = EVP_CIPHER_CTX_new();
+    if (m_ctx == nullptr) return true;
+
+    /* EVP_CipherInit() returns 1 for success and 0 for failure */
+    res = EVP_CipherInit(m_ctx, Aes_ctr::get_evp_cipher(), m_file_key, m_iv,
+                         static_cast<int>(TYPE));
+  } else {
+    /*
+      Repositioning the stream only changes the counter. Keep the context
+      and its expanded key, and just load the new IV.
+    */
+    res = EVP_CipherInit_ex(m_ctx, nullptr, nullptr, nullptr, m_iv,
+                            static_cast<int>(TYPE));
+  }
 
   return res == 0;
 }
@@ -95,6 +95,7 @@
 #include "sql/conn_handler/connection_handler_impl.h"  // Per_thread_connection_handler
 #include "sql/conn_handler/connection_handler_manager.h"  // Connection_handler_manager
 #include "sql/conn_handler/socket_connection.h"  // MY_BIND_ALL_ADDRESSES
+#include "sql/dd/dd.h"
 #include "sql/derror.h"                          // read_texts
 #include "sql/discrete_interval.h"
 #include "sql/events.h"          // Events
@@ -4636,13 +4637,22 @@ static Sys_var_charptr Sys_system_time_zone(
     READ_ONLY NON_PERSIST GLOBAL_VAR(system_time_zone_ptr), NO_CMD_LINE,
     IN_FS_CHARSET, DEFAULT(system_time_zone));
 
+static bool fix_table_def_size(sys_var *, THD *, enum_var_type) {
+  /*
+    The shared dictionary cache keeps room for the table objects of all
+    cached table definitions.
+  */
+  dd::update_table_cache_capacity();
+  return false;
+}
+
 static Sys_var_ulong Sys_table_def_size(
     "table_definition_cache", "The number of cached table definitions",
     GLOBAL_VAR(table_def_size),
     CMD_LINE(REQUIRED_ARG, OPT_TABLE_DEFINITION_CACHE),
     VALID_RANGE(TABLE_DEF_CACHE_MIN, 512 * 1024),
     DEFAULT(TABLE_DEF_CACHE_DEFAULT), BLOCK_SIZE(1), NO_MUTEX_GUARD,
-    NOT_IN_BINLOG, ON_CHECK(nullptr), ON_UPDATE(nullptr), nullptr,
+    NOT_IN_BINLOG, ON_CHECK(nullptr), ON_UPDATE(fix_table_def_size), nullptr,
     /* table_definition_cache is used as a sizing hint by the performance
        schema. */
     sys_var::PARSE_EARLY);
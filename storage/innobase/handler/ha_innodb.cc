@@ -9037,10 +9037,13 @@ static dberr_t calc_row_difference(
         multi_value_calc_by_diff = true;
       }
 
-      if (n_len != UNIV_SQL_NULL) {
+      if (multi_value_calc_by_diff) {
+        /* The new value has already been parsed out above */
+        dfield_copy(&ufield->new_val, &new_field);
+      } else if (n_len != UNIV_SQL_NULL) {
         col->copy_type(dfield_get_type(&dfield));
 
-        if (is_multi_value && !multi_value_calc_by_diff) {
+        if (is_multi_value) {
           innobase_get_multi_value(prebuilt->m_mysql_table, i, &dfield, nullptr,
                                    0, comp, uvect->heap);
         } else {
@@ -9049,11 +9052,7 @@ static dberr_t calc_row_difference(
                                                        col_pack_len, comp);
         }
 
-        if (multi_value_calc_by_diff) {
-          dfield_copy(&ufield->new_val, &new_field);
-        } else {
-          dfield_copy(&ufield->new_val, &dfield);
-        }
+        dfield_copy(&ufield->new_val, &dfield);
       } else {
         col->copy_type(dfield_get_type(&ufield->new_val));
         dfield_set_null(&ufield->new_val);
@@ -9072,12 +9071,16 @@ static dberr_t calc_row_difference(
         ufield->old_v_val = static_cast<dfield_t *>(
             mem_heap_alloc(uvect->heap, sizeof *ufield->old_v_val));
 
-        if (!field->is_null_in_record(old_row)) {
+        if (multi_value_calc_by_diff) {
+          /* The old value has already been parsed out above */
+          dfield_copy(ufield->old_v_val, &old_field);
+          dfield_copy(vfield, &old_field);
+        } else if (!field->is_null_in_record(old_row)) {
           if (n_len == UNIV_SQL_NULL) {
             col->copy_type(dfield_get_type(&dfield));
           }
 
-          if (is_multi_value && !multi_value_calc_by_diff) {
+          if (is_multi_value) {
             innobase_get_multi_value(
                 prebuilt->m_mysql_table, i, &dfield, nullptr,
                 static_cast<uint>(old_row - new_row), comp, uvect->heap);
@@ -9087,13 +9090,8 @@ static dberr_t calc_row_difference(
                 comp);
           }
 
-          if (multi_value_calc_by_diff) {
-            dfield_copy(ufield->old_v_val, &old_field);
-            dfield_copy(vfield, &old_field);
-          } else {
-            dfield_copy(ufield->old_v_val, &dfield);
-            dfield_copy(vfield, &dfield);
-          }
+          dfield_copy(ufield->old_v_val, &dfield);
+          dfield_copy(vfield, &dfield);
         } else {
           col->copy_type(dfield_get_type(ufield->old_v_val));
           dfield_set_null(ufield->old_v_val);
@@ -599,6 +599,8 @@ ha_innopart::ha_innopart(handlerton *hton, TABLE_SHARE *table_arg)
       m_ins_node_parts(),
       m_upd_node_parts(),
       m_blob_heap_parts(),
+      m_blob_heap_first(0),
+      m_blob_heap_end(0),
       m_trx_id_parts(),
       m_row_read_type_parts(),
       m_bitset(),
@@ -835,6 +837,9 @@ int ha_innopart::open(const char *name, int, uint, const dd::Table *table_def) {
     set_ha_share_ptr(static_cast<Handler_share *>(m_part_share));
   }
 
+  /* Set to true if this handler opened the InnoDB tables of the share. */
+  bool opened_table_parts = false;
+
   if (m_part_share->has_table_parts()) {
     /* If share already has InnoDB tables open we just need to increment
     reference counters. */
@@ -860,6 +865,7 @@ int ha_innopart::open(const char *name, int, uint, const dd::Table *table_def) {
                                                   table_parts)) {
       goto share_error;
     }
+    opened_table_parts = true;
   }
 
   if (m_part_share->populate_partition_name_hash(m_part_info)) {
@@ -893,12 +899,18 @@ int ha_innopart::open(const char *name, int, uint, const dd::Table *table_def) {
   }
 
   /* Currently we track statistics for all partitions, but for
-  the secondary indexes we only use the biggest partition. */
-
-  for (uint part_id = 0; part_id < m_tot_parts; part_id++) {
-    innobase_copy_frm_flags_from_table_share(
-        m_part_share->get_table_part(part_id), table->s);
-    dict_stats_init(m_part_share->get_table_part(part_id));
+  the secondary indexes we only use the biggest partition.
+  The flags come from the TABLE_SHARE and the statistics stay initialized
+  while the share holds references to the partitions, so this is only
+  needed when the partitions were opened for the share. Otherwise every
+  open of a table with thousands of partitions would pay for it. */
+
+  if (opened_table_parts) {
+    for (uint part_id = 0; part_id < m_tot_parts; part_id++) {
+      innobase_copy_frm_flags_from_table_share(
+          m_part_share->get_table_part(part_id), table->s);
+      dict_stats_init(m_part_share->get_table_part(part_id));
+    }
   }
 
   MONITOR_INC(MONITOR_TABLE_OPEN);
@@ -1353,7 +1365,19 @@ void ha_innopart::update_partition(uint part_id) {
 
   /* For unordered scan and table scan, use blob_heap from first
   partition as we need exactly one blob anytime. */
-  m_blob_heap_parts[m_ordered ? part_id : 0] = m_prebuilt->blob_heap;
+  const uint heap_part = m_ordered ? part_id : 0;
+  m_blob_heap_parts[heap_part] = m_prebuilt->blob_heap;
+
+  if (m_prebuilt->blob_heap != nullptr) {
+    if (m_blob_heap_first >= m_blob_heap_end) {
+      m_blob_heap_first = heap_part;
+      m_blob_heap_end = heap_part + 1;
+    } else if (heap_part < m_blob_heap_first) {
+      m_blob_heap_first = heap_part;
+    } else if (heap_part >= m_blob_heap_end) {
+      m_blob_heap_end = heap_part + 1;
+    }
+  }
 
   m_trx_id_parts[part_id] = m_prebuilt->trx_id;
   m_row_read_type_parts[part_id] = m_prebuilt->row_read_type;
@@ -4047,51 +4071,64 @@ int ha_innopart::external_lock(THD *thd, int lock_type) {
   m_prebuilt->table = m_part_share->get_table_part(0);
   error = ha_innobase::external_lock(thd, lock_type);
 
-  for (uint i = 0; i < m_tot_parts; i++) {
-    dict_table_t *table = m_part_share->get_table_part(i);
+  /* Partitions only need to be visited to start or complete a quiesce
+  (FLUSH TABLES ... FOR EXPORT and the following UNLOCK TABLES). Skip the
+  loop for ordinary statements, which would otherwise touch every
+  partition on each lock and unlock, whatever was pruned. */
+  const bool may_start_quiesce = !srv_read_only_mode &&
+                                 thd_sql_command(thd) == SQLCOM_FLUSH &&
+                                 lock_type == F_RDLCK;
+  const bool may_complete_quiesce =
+      m_prebuilt->trx->flush_tables > 0 &&
+      (lock_type == F_UNLCK || trx_is_interrupted(m_prebuilt->trx));
+
+  if (may_start_quiesce || may_complete_quiesce) {
+    for (uint i = 0; i < m_tot_parts; i++) {
+      dict_table_t *table = m_part_share->get_table_part(i);
 
-    switch (table->quiesce) {
-      case QUIESCE_START:
-        /* Check for FLUSH TABLE t WITH READ LOCK */
-        if (!srv_read_only_mode && thd_sql_command(thd) == SQLCOM_FLUSH &&
-            lock_type == F_RDLCK) {
-          ut_ad(table->quiesce == QUIESCE_START);
+      switch (table->quiesce) {
+        case QUIESCE_START:
+          /* Check for FLUSH TABLE t WITH READ LOCK */
+          if (!srv_read_only_mode && thd_sql_command(thd) == SQLCOM_FLUSH &&
+              lock_type == F_RDLCK) {
+            ut_ad(table->quiesce == QUIESCE_START);
 
-          if (dict_table_is_discarded(table)) {
-            ib_senderrf(m_prebuilt->trx->mysql_thd, IB_LOG_LEVEL_ERROR,
-                        ER_TABLESPACE_DISCARDED, table->name.m_name);
+            if (dict_table_is_discarded(table)) {
+              ib_senderrf(m_prebuilt->trx->mysql_thd, IB_LOG_LEVEL_ERROR,
+                          ER_TABLESPACE_DISCARDED, table->name.m_name);
 
-            return (HA_ERR_NO_SUCH_TABLE);
-          }
+              return (HA_ERR_NO_SUCH_TABLE);
+            }
 
-          row_quiesce_table_start(table, m_prebuilt->trx);
+            row_quiesce_table_start(table, m_prebuilt->trx);
 
-          /* Use the transaction instance to track
-          UNLOCK TABLES. It can be done via START
-          TRANSACTION; too implicitly. */
+            /* Use the transaction instance to track
+            UNLOCK TABLES. It can be done via START
+            TRANSACTION; too implicitly. */
 
-          ++m_prebuilt->trx->flush_tables;
-        }
-        break;
+            ++m_prebuilt->trx->flush_tables;
+          }
+          break;
 
-      case QUIESCE_COMPLETE:
-        /* Check for UNLOCK TABLES; implicit or explicit
-        or trx interruption. */
-        if (m_prebuilt->trx->flush_tables > 0 &&
-            (lock_type == F_UNLCK || trx_is_interrupted(m_prebuilt->trx))) {
-          ut_ad(table->quiesce == QUIESCE_COMPLETE);
-          row_quiesce_table_complete(table, m_prebuilt->trx);
+        case QUIESCE_COMPLETE:
+          /* Check for UNLOCK TABLES; implicit or explicit
+          or trx interruption. */
+          if (m_prebuilt->trx->flush_tables > 0 &&
+              (lock_type == F_UNLCK || trx_is_interrupted(m_prebuilt->trx))) {
+            ut_ad(table->quiesce == QUIESCE_COMPLETE);
+            row_quiesce_table_complete(table, m_prebuilt->trx);
 
-          ut_a(m_prebuilt->trx->flush_tables > 0);
-          --m_prebuilt->trx->flush_tables;
-        }
-        break;
+            ut_a(m_prebuilt->trx->flush_tables > 0);
+            --m_prebuilt->trx->flush_tables;
+          }
+          break;
 
-      case QUIESCE_NONE:
-        break;
+        case QUIESCE_NONE:
+          break;
 
-      default:
-        ut_ad(0);
+        default:
+          ut_ad(0);
+      }
     }
   }
 
@@ -4183,7 +4220,9 @@ void ha_innopart::clear_blob_heaps() {
     return;
   }
 
-  for (uint i = 0; i < m_tot_parts; i++) {
+  ut_ad(m_blob_heap_end <= m_tot_parts);
+
+  for (uint i = m_blob_heap_first; i < m_blob_heap_end; i++) {
     if (m_blob_heap_parts[i] != nullptr) {
       DBUG_PRINT("ha_innopart",
                  ("freeing blob_heap: %p", m_blob_heap_parts[i]));
@@ -4191,6 +4230,14 @@ void ha_innopart::clear_blob_heaps() {
       m_blob_heap_parts[i] = nullptr;
     }
   }
+  m_blob_heap_first = 0;
+  m_blob_heap_end = 0;
+
+#ifdef UNIV_DEBUG
+  for (uint i = 0; i < m_tot_parts; i++) {
+    ut_ad(m_blob_heap_parts[i] == nullptr);
+  }
+#endif /* UNIV_DEBUG */
 
   /* Reset blob_heap in m_prebuilt after freeing all heaps. It is set in
   ha_innopart::set_partition to the blob heap of current partition. */
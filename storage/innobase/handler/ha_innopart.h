@@ -613,6 +613,12 @@ class ha_innopart : public ha_innobase,
   when changing partitions. */
   mem_heap_t **m_blob_heap_parts;
 
+  /** Range [m_blob_heap_first, m_blob_heap_end) of m_blob_heap_parts
+  which may hold heaps, so that clear_blob_heaps() called at the end of
+  every statement does not need to visit all partitions. */
+  uint m_blob_heap_first;
+  uint m_blob_heap_end;
+
   /** trx_id from the partitions table->def_trx_id. Keep in sync
   with prebuilt->trx_id when changing partitions.
   prebuilt only reflects the current partition! */
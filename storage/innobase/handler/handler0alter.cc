@@ -114,7 +114,12 @@ enum class Instant_Type : uint16_t {
 
   /** ADD COLUMN which can be done instantly, including
   adding stored column only (or along with adding virtual columns) */
-  INSTANT_ADD_COLUMN
+  INSTANT_ADD_COLUMN,
+
+  /** Changing column definitions without changing the physical format of
+  existing rows, such as widening a VARCHAR within the same length-byte
+  class. Only the data dictionary has to be updated */
+  INSTANT_COLUMN_METADATA
 };
 
 /** Function to convert the Instant_Type to a comparable int */
@@ -583,6 +588,40 @@ static void innobase_discard_table(THD *thd, dict_table_t *table) {
   table->discard_after_ddl = true;
 }
 
+/** Determine if changing column definitions keeps the stored format of
+existing records. In ROW_FORMAT=REDUNDANT, a CHAR column occupies the maximum
+byte length of the column, which depends on the character set.
+@param[in]	ha_alter_info	The DDL operation
+@param[in]	table		InnoDB table
+@param[in]	old_table	old TABLE
+@return true if only the column metadata changes */
+static bool innobase_column_change_keeps_format(
+    const Alter_inplace_info *ha_alter_info, const dict_table_t *table,
+    const TABLE *old_table) {
+  if (dict_table_is_comp(table)) {
+    return (true);
+  }
+
+  List_iterator_fast<Create_field> cf_it(
+      ha_alter_info->alter_info->create_list);
+
+  for (Field **fp = old_table->field; *fp; fp++) {
+    if ((*fp)->real_type() != MYSQL_TYPE_STRING) {
+      continue;
+    }
+
+    cf_it.rewind();
+    while (const Create_field *cf = cf_it++) {
+      if (cf->field == *fp &&
+          cf->charset->mbmaxlen != (*fp)->charset()->mbmaxlen) {
+        return (false);
+      }
+    }
+  }
+
+  return (true);
+}
+
 /** Determine if one ALTER TABLE can be done instantly on the table
 @param[in]	ha_alter_info	The DDL operation
 @param[in]	table		InnoDB table
@@ -606,6 +645,15 @@ static inline Instant_Type innobase_support_instant(
     return (Instant_Type::INSTANT_VIRTUAL_ONLY);
   }
 
+  /* If it's only enlarging columns without changing the stored format,
+  existing records remain valid as they are. Column renames are excluded,
+  since the DD columns are matched by name when committing. */
+  if (alter_inplace_flags ==
+          Alter_inplace_info::ALTER_COLUMN_EQUAL_PACK_LENGTH &&
+      innobase_column_change_keeps_format(ha_alter_info, table, old_table)) {
+    return (Instant_Type::INSTANT_COLUMN_METADATA);
+  }
+
   if (!table->support_instant_add()) {
     return (Instant_Type::INSTANT_IMPOSSIBLE);
   }
@@ -769,6 +817,7 @@ enum_alter_inplace_result ha_innobase::check_if_supported_inplace_alter(
         /* Fall through */
       case Instant_Type::INSTANT_NO_CHANGE:
       case Instant_Type::INSTANT_VIRTUAL_ONLY:
+      case Instant_Type::INSTANT_COLUMN_METADATA:
         ha_alter_info->handler_trivial_ctx = instant_type_to_int(instant_type);
         return HA_ALTER_INPLACE_INSTANT;
     }
@@ -4123,6 +4172,16 @@ static void dd_commit_inplace_instant(Alter_inplace_info *ha_alter_info,
       innobase_discard_table(thd, table);
       row_mysql_unlock_data_dictionary(trx);
       break;
+    case Instant_Type::INSTANT_COLUMN_METADATA:
+      dd_commit_inplace_no_change(old_dd_tab, new_dd_tab, false);
+
+      /* The cached column lengths are stale, reload them from the DD.
+      The indexes are unchanged, so the persistent statistics stay valid
+      and must not be dropped as innobase_discard_table() would do. */
+      row_mysql_lock_data_dictionary(trx);
+      table->discard_after_ddl = true;
+      row_mysql_unlock_data_dictionary(trx);
+      break;
     case Instant_Type::INSTANT_ADD_COLUMN:
       dd_copy_private(*new_dd_tab, *old_dd_tab);
 
@@ -9934,6 +9993,7 @@ enum_alter_inplace_result ha_innopart::check_if_supported_inplace_alter(
       /* Fall through */
     case Instant_Type::INSTANT_NO_CHANGE:
     case Instant_Type::INSTANT_VIRTUAL_ONLY:
+    case Instant_Type::INSTANT_COLUMN_METADATA:
       ha_alter_info->handler_trivial_ctx = instant_type_to_int(instant_type);
       return HA_ALTER_INPLACE_INSTANT;
   }
@@ -201,6 +201,9 @@ struct row_log_t {
                         or by index->lock X-latch only */
   row_log_buf_t head;   /*!< reader context; protected by MDL only;
                         modifiable by row_log_apply_ops() */
+  bool sparse;          /*!< whether the storage of all blocks
+                        before head.blocks has been released;
+                        protected by index->lock X-latch */
   ulint n_old_col;
   /*!< number of non-virtual column in
   old table */
@@ -258,6 +261,41 @@ static void row_log_block_free(row_log_buf_t &log_buf) {
   }
 }
 
+/** Check whether buffering one more block would make the modification log
+exceed innodb_online_alter_log_max_size. Blocks that have already been
+applied do not count when their storage was released.
+@param[in]	log	online rebuild log; protected by index->lock
+@return true if the log is full */
+static bool row_log_is_full(const row_log_t *log) {
+  ulint blocks = log->tail.blocks;
+
+  if (log->sparse) {
+    ut_ad(log->head.blocks <= blocks);
+    blocks -= log->head.blocks;
+  }
+
+  return ((os_offset_t)(blocks + 1) * srv_sort_buf_size >=
+          srv_online_max_size);
+}
+
+/** Release a block of the temporary file that has been read by the
+applier. Each block is read exactly once, so both the file cache and the
+disk space can be given back while the DML keeps appending to the log.
+@param[in]	log	online rebuild log
+@param[in]	ofs	offset of the block
+@return true if the disk space of the block was freed */
+static bool row_log_block_release(const row_log_t *log, os_offset_t ofs) {
+#ifdef POSIX_FADV_DONTNEED
+  posix_fadvise(log->fd, ofs, srv_sort_buf_size, POSIX_FADV_DONTNEED);
+#endif /* POSIX_FADV_DONTNEED */
+
+#ifdef _WIN32
+  return (false);
+#else
+  return (os_file_punch_hole(log->fd, ofs, srv_sort_buf_size) == DB_SUCCESS);
+#endif /* _WIN32 */
+}
+
 /** Logs an operation to a secondary index that is (or was) being created. */
 void row_log_online_op(
     dict_index_t *index,   /*!< in/out: index, S or X latched */
@@ -344,7 +382,7 @@ void row_log_online_op(
     const os_offset_t byte_offset =
         (os_offset_t)log->tail.blocks * srv_sort_buf_size;
 
-    if (byte_offset + srv_sort_buf_size >= srv_online_max_size) {
+    if (row_log_is_full(log)) {
       goto write_failed;
     }
 
@@ -448,7 +486,7 @@ static void row_log_table_close_func(
     const os_offset_t byte_offset =
         (os_offset_t)log->tail.blocks * srv_sort_buf_size;
 
-    if (byte_offset + srv_sort_buf_size >= srv_online_max_size) {
+    if (row_log_is_full(log)) {
       goto write_failed;
     }
 
@@ -2698,6 +2736,7 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t
   heap = mem_heap_create(UNIV_PAGE_SIZE);
   offsets_heap = mem_heap_create(UNIV_PAGE_SIZE);
   has_index_lock = true;
+  bool block_released = false;
 
 next_block:
   ut_ad(has_index_lock);
@@ -2743,6 +2782,7 @@ next_block:
       }
 #endif /* HAVE_FTRUNCATE */
       index->online_log->head.blocks = index->online_log->tail.blocks = 0;
+      index->online_log->sparse = true;
     }
 
     next_mrec = index->online_log->tail.block;
@@ -2790,11 +2830,7 @@ next_block:
       goto corruption;
     }
 
-#ifdef POSIX_FADV_DONTNEED
-    /* Each block is read exactly once.  Free up the file cache. */
-    posix_fadvise(index->online_log->fd, ofs, srv_sort_buf_size,
-                  POSIX_FADV_DONTNEED);
-#endif /* POSIX_FADV_DONTNEED */
+    block_released = row_log_block_release(index->online_log, ofs);
 
     next_mrec = index->online_log->head.block;
     next_mrec_end = next_mrec + srv_sort_buf_size;
@@ -2940,6 +2976,10 @@ next_block:
       rw_lock_x_lock(dict_index_get_lock(index));
       has_index_lock = true;
 
+      if (!block_released) {
+        index->online_log->sparse = false;
+      }
+
       index->online_log->head.bytes = 0;
       index->online_log->head.blocks++;
       goto next_block;
@@ -3071,6 +3111,7 @@ bool row_log_allocate(
   log->tail.block = log->head.block = nullptr;
   log->head.blocks = log->head.bytes = 0;
   log->head.total = 0;
+  log->sparse = true;
   log->path = path;
   log->n_old_col = index->table->n_cols;
   log->n_old_vcol = index->table->n_v_cols;
@@ -3469,6 +3510,7 @@ static dberr_t row_log_apply_ops(const trx_t *trx, dict_index_t *index,
   offsets_heap = mem_heap_create(UNIV_PAGE_SIZE);
   heap = mem_heap_create(UNIV_PAGE_SIZE);
   has_index_lock = true;
+  bool block_released = false;
 
 next_block:
   ut_ad(has_index_lock);
@@ -3511,6 +3553,7 @@ next_block:
       }
 #endif /* HAVE_FTRUNCATE */
       index->online_log->head.blocks = index->online_log->tail.blocks = 0;
+      index->online_log->sparse = true;
     }
 
     next_mrec = index->online_log->tail.block;
@@ -3553,11 +3596,7 @@ next_block:
       goto corruption;
     }
 
-#ifdef POSIX_FADV_DONTNEED
-    /* Each block is read exactly once.  Free up the file cache. */
-    posix_fadvise(index->online_log->fd, ofs, srv_sort_buf_size,
-                  POSIX_FADV_DONTNEED);
-#endif /* POSIX_FADV_DONTNEED */
+    block_released = row_log_block_release(index->online_log, ofs);
 
     next_mrec = index->online_log->head.block;
     next_mrec_end = next_mrec + srv_sort_buf_size;
@@ -3678,6 +3717,10 @@ next_block:
       rw_lock_x_lock(dict_index_get_lock(index));
       has_index_lock = true;
 
+      if (!block_released) {
+        index->online_log->sparse = false;
+      }
+
       index->online_log->head.bytes = 0;
       index->online_log->head.blocks++;
       goto next_block;
@@ -3712,9 +3755,7 @@ func_exit:
     case DB_SUCCESS:
       break;
     case DB_INDEX_CORRUPT:
-      if (((os_offset_t)index->online_log->tail.blocks + 1) *
-              srv_sort_buf_size >=
-          srv_online_max_size) {
+      if (row_log_is_full(index->online_log)) {
         /* The log file grew too big. */
         error = DB_ONLINE_LOG_TOO_BIG;
       }
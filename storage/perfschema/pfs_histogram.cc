@@ -27,6 +27,8 @@
 
 #include "storage/perfschema/pfs_histogram.h"
 
+#include "my_dbug.h"
+
 /**
   Histogram base bucket timer, in picoseconds.
   Currently defined as 10 micro second.
@@ -64,6 +66,57 @@ void PFS_histogram::reset() {
   }
 }
 
+void PFS_histogram_snapshot::read(const PFS_histogram *histogram) {
+  uint bucket_index;
+  ulonglong value;
+
+  m_count_star = 0;
+
+  for (bucket_index = 0; bucket_index < NUMBER_OF_BUCKETS; bucket_index++) {
+    value = histogram->read_bucket(bucket_index);
+    m_bucket[bucket_index] = value;
+    m_count_star += value;
+  }
+}
+
+uint PFS_histogram_snapshot::get_quantile_bucket(ulonglong numerator,
+                                                 ulonglong denominator) const {
+  DBUG_ASSERT(denominator != 0);
+  DBUG_ASSERT(numerator <= denominator);
+
+  if (m_count_star == 0) {
+    return 0;
+  }
+
+  /* Rounded up, so that the quantile count is never 0. */
+  ulonglong target =
+      ((m_count_star * numerator) + denominator - 1) / denominator;
+  ulonglong count = 0;
+  uint bucket_index;
+
+  DBUG_ASSERT(target <= m_count_star);
+
+  for (bucket_index = 0; bucket_index < NUMBER_OF_BUCKETS; bucket_index++) {
+    count += m_bucket[bucket_index];
+    if (count >= target) {
+      return bucket_index;
+    }
+  }
+
+  DBUG_ASSERT(false);
+  return NUMBER_OF_BUCKETS - 1;
+}
+
+ulonglong PFS_histogram_snapshot::get_quantile_timer(
+    ulonglong numerator, ulonglong denominator) const {
+  if (m_count_star == 0) {
+    return 0;
+  }
+
+  uint bucket_index = get_quantile_bucket(numerator, denominator);
+  return g_histogram_pico_timers.m_bucket_timer[bucket_index + 1];
+}
+
 void PFS_histogram_timers::init() {
   ulong bucket_index;
   double current_bucket_timer = BUCKET_BASE_TIMER;
@@ -40,12 +40,52 @@ struct PFS_histogram {
 
   void increment_bucket(uint bucket_index) { m_bucket[bucket_index]++; }
 
-  ulonglong read_bucket(uint bucket_index) { return m_bucket[bucket_index]; }
+  ulonglong read_bucket(uint bucket_index) const {
+    return m_bucket[bucket_index];
+  }
 
  private:
   std::atomic<ulonglong> m_bucket[NUMBER_OF_BUCKETS];
 };
 
+/**
+  Point in time copy of a @c PFS_histogram.
+  Buckets are read once, without locks, so that every statistic
+  computed from a snapshot (count, quantiles) is self consistent,
+  even when the source histogram is concurrently updated.
+*/
+struct PFS_histogram_snapshot {
+ public:
+  /** Copy the current bucket values of a histogram. */
+  void read(const PFS_histogram *histogram);
+
+  ulonglong get_bucket(uint bucket_index) const {
+    return m_bucket[bucket_index];
+  }
+
+  ulonglong get_count_star() const { return m_count_star; }
+
+  /**
+    Find the bucket containing a given quantile.
+    The quantile is expressed as the fraction @c numerator / @c denominator,
+    for example 99 / 100 for the 99th percentile.
+    @return the index of the first bucket where the cumulated count
+    reaches the quantile, or 0 for an empty histogram.
+  */
+  uint get_quantile_bucket(ulonglong numerator, ulonglong denominator) const;
+
+  /**
+    Upper timer bound, in picoseconds, of a given quantile.
+    @return the high timer of the quantile bucket, or 0 for an empty histogram.
+  */
+  ulonglong get_quantile_timer(ulonglong numerator,
+                               ulonglong denominator) const;
+
+ private:
+  ulonglong m_bucket[NUMBER_OF_BUCKETS];
+  ulonglong m_count_star;
+};
+
 struct PFS_histogram_timers {
   ulonglong m_bucket_timer[NUMBER_OF_BUCKETS + 1];
 
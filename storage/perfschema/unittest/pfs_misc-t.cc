@@ -25,6 +25,7 @@
 #include "my_thread.h"
 #include "storage/perfschema/pfs_buffer_container.h"
 #include "storage/perfschema/pfs_global.h"
+#include "storage/perfschema/pfs_histogram.h"
 #include "storage/perfschema/pfs_instr.h"
 #include "storage/perfschema/pfs_instr_class.h"
 #include "storage/perfschema/pfs_stat.h"
@@ -78,10 +79,42 @@ static void test_digest_length_overflow() {
   ok(rc == 1, "digest length overflow (init_digest)");
 }
 
-static void do_all_tests() { test_digest_length_overflow(); }
+static void test_histogram_quantiles() {
+  static PFS_histogram histogram;
+  PFS_histogram_snapshot snapshot;
+
+  g_histogram_pico_timers.init();
+  histogram.reset();
+
+  snapshot.read(&histogram);
+  ok(snapshot.get_count_star() == 0, "empty histogram count");
+  ok(snapshot.get_quantile_timer(99, 100) == 0, "empty histogram quantile");
+
+  /* 90 fast events in bucket 10, 10 slow events in bucket 200. */
+  for (int i = 0; i < 90; i++) {
+    histogram.increment_bucket(10);
+  }
+  for (int i = 0; i < 10; i++) {
+    histogram.increment_bucket(200);
+  }
+
+  snapshot.read(&histogram);
+  ok(snapshot.get_count_star() == 100, "histogram count");
+  ok(snapshot.get_quantile_bucket(50, 100) == 10, "p50 bucket");
+  ok(snapshot.get_quantile_bucket(90, 100) == 10, "p90 bucket");
+  ok(snapshot.get_quantile_bucket(95, 100) == 200, "p95 bucket");
+  ok(snapshot.get_quantile_timer(95, 100) ==
+         g_histogram_pico_timers.m_bucket_timer[201],
+     "p95 timer");
+}
+
+static void do_all_tests() {
+  test_digest_length_overflow();
+  test_histogram_quantiles();
+}
 
 int main(int, char **) {
-  plan(3);
+  plan(10);
   MY_INIT("pfs_misc-t");
   do_all_tests();
   my_end(0);
@@ -1556,6 +1556,23 @@ ALWAYS_INLINE int uca_scanner_900<Mb_wc, LEVELS_FOR_COMPARE>::next_raw() {
   return rtn;
 }
 
+/**
+  Check if any of the bytes in the given word is outside the range
+  0x20..0x7e, inclusive. The characters in this range have exactly one
+  weight on each level in the untailored UCA 9.0.0 collations, and are
+  always encoded as a single byte.
+
+  The lowest out-of-range byte always sets its own high bit in either the
+  sum or the difference below, since no carry or borrow can come from the
+  (in-range) bytes below it. See the FastOutOfRange unit tests for
+  verification that the bitfiddling trick is correct.
+*/
+template <class T>
+static inline bool any_byte_outside_printable_ascii(T bytes) {
+  constexpr T ones = static_cast<T>(~T{0}) / 0xff;
+  return ((bytes + ones) | (bytes - ones * 0x20)) & (ones * 0x80);
+}
+
 template <class Mb_wc, int LEVELS_FOR_COMPARE>
 template <class T, class U>
 ALWAYS_INLINE void uca_scanner_900<Mb_wc, LEVELS_FOR_COMPARE>::for_each_weight(
@@ -1582,6 +1599,7 @@ ALWAYS_INLINE void uca_scanner_900<Mb_wc, LEVELS_FOR_COMPARE>::for_each_weight(
     (In particular, this catches the case of sbeg == send == nullptr.)
   */
   const uchar *send_local = (send - sbeg > 3) ? (send - 3) : sbeg;
+  const uchar *send_local16 = (send - sbeg > 15) ? (send - 15) : sbeg;
 
   for (;;) {
     /*
@@ -1600,20 +1618,36 @@ ALWAYS_INLINE void uca_scanner_900<Mb_wc, LEVELS_FOR_COMPARE>::for_each_weight(
       we'd otherwise have to do.
     */
     const uchar *sbeg_local = sbeg;
+
+    /*
+      Long runs of ASCII are common, so take them 16 bytes at a time first,
+      checking two 64-bit words at once. This amortizes both the range check
+      and the preaccept_data() bounds check over more characters, and gives
+      the compiler an unrolled sequence of independent table lookups.
+    */
+    while (sbeg_local < send_local16 && preaccept_data(16)) {
+      uint64 sixteen_bytes[2];
+      memcpy(sixteen_bytes, sbeg_local, sizeof(sixteen_bytes));
+      if (any_byte_outside_printable_ascii(sixteen_bytes[0]) ||
+          any_byte_outside_printable_ascii(sixteen_bytes[1]))
+        break;
+      for (int i = 0; i < 16; ++i) {
+        const int s_res = ascii_wpage[sbeg_local[i]];
+        DBUG_ASSERT(s_res != 0);
+        func(s_res, /*is_level_separator=*/false);
+      }
+      sbeg_local += 16;
+    }
+
     while (sbeg_local < send_local && preaccept_data(sizeof(uint32))) {
       /*
         Check if all four bytes are in the range 0x20..0x7e, inclusive.
         These have exactly one weight. Note that this unfortunately does not
         include tab and newline, which would otherwise be legal candidates.
-
-        See the FastOutOfRange unit test for verification that the bitfiddling
-        trick used here is correct.
       */
       uint32 four_bytes;
       memcpy(&four_bytes, sbeg_local, sizeof(four_bytes));
-      if (((four_bytes + 0x01010101u) & 0x80808080) ||
-          ((four_bytes - 0x20202020u) & 0x80808080))
-        break;
+      if (any_byte_outside_printable_ascii(four_bytes)) break;
       const int s_res0 = ascii_wpage[sbeg_local[0]];
       const int s_res1 = ascii_wpage[sbeg_local[1]];
       const int s_res2 = ascii_wpage[sbeg_local[2]];
@@ -1640,6 +1674,26 @@ ALWAYS_INLINE void uca_scanner_900<Mb_wc, LEVELS_FOR_COMPARE>::for_each_weight(
   }
 }
 
+/**
+  Find the length of the longest common prefix of two strings that
+  consists of printable ASCII characters (0x20..0x7e) only.
+*/
+static size_t common_printable_ascii_prefix(const uchar *s, size_t slen,
+                                            const uchar *t, size_t tlen) {
+  const size_t len = std::min(slen, tlen);
+  size_t pos = 0;
+  for (; pos + sizeof(uint64) <= len; pos += sizeof(uint64)) {
+    uint64 s_bytes, t_bytes;
+    memcpy(&s_bytes, s + pos, sizeof(s_bytes));
+    memcpy(&t_bytes, t + pos, sizeof(t_bytes));
+    if (s_bytes != t_bytes || any_byte_outside_printable_ascii(s_bytes))
+      break;
+  }
+  while (pos < len && s[pos] == t[pos] && s[pos] >= 0x20 && s[pos] <= 0x7e)
+    ++pos;
+  return pos;
+}
+
 /**
   Change a weight according to the reorder parameters.
   @param   weight     The weight to change
@@ -4886,6 +4940,21 @@ static size_t my_strnxfrm_any_uca(const CHARSET_INFO *cs, uchar *dst,
 static int my_strnncoll_uca_900(const CHARSET_INFO *cs, const uchar *s,
                                 size_t slen, const uchar *t, size_t tlen,
                                 bool t_is_prefix) {
+  if (!cs->tailoring && cs->mbminlen == 1 && !cs->coll_param) {
+    /*
+      In the untailored collations, every printable ASCII character has
+      exactly one weight on each level, regardless of its neighbours. A
+      common prefix of such characters thus contributes the same weights
+      to both strings on every level, and can be skipped without changing
+      the result of the comparison.
+    */
+    const size_t prefix_len = common_printable_ascii_prefix(s, slen, t, tlen);
+    s += prefix_len;
+    slen -= prefix_len;
+    t += prefix_len;
+    tlen -= prefix_len;
+  }
+
   if (cs->cset->mb_wc == my_mb_wc_utf8mb4_thunk) {
     switch (cs->levels_for_compare) {
       case 1:
@@ -1569,6 +1569,153 @@ err:
   return (E_DEC_BAD_NUM);
 }
 
+/*
+  Reads a group of 'digits' decimal digits from the binary format.
+
+  SYNOPSIS
+    read_bin_group()
+      from    - position in a copy of the binary value with the sign bit
+                flipped
+      digits  - number of decimal digits in the group, 1..DIG_PER_DEC1
+      mask    - 0 for positive values, -1 for negative values
+
+  RETURN VALUE
+    the digits of the group as an integer
+*/
+
+static inline dec1 read_bin_group(const uchar *from, int digits, dec1 mask) {
+  dec1 x = 0;
+  switch (dig2bytes[digits]) {
+    case 1:
+      x = mi_sint1korr(from);
+      break;
+    case 2:
+      x = mi_sint2korr(from);
+      break;
+    case 3:
+      x = mi_sint3korr(from);
+      break;
+    case 4:
+      x = mi_sint4korr(from);
+      break;
+    default:
+      DBUG_ASSERT(0);
+  }
+  return x ^ mask;
+}
+
+/*
+  Convert decimal from binary representation to an integer scaled by
+  10^scale, i.e. the value with the decimal point removed
+
+  SYNOPSIS
+    bin2scaled_longlong()
+      from    - value to convert
+      to      - result
+      precision/scale - see decimal_bin_size() below
+
+  NOTE
+    This is a shortcut of bin2decimal() for the common small DECIMAL
+    columns, which skips the decimal_t representation altogether.
+    precision must not exceed DECIMAL_LONGLONG_PRECISION, so that the
+    result always fits.
+
+  RETURN VALUE
+    E_DEC_OK/E_DEC_BAD_NUM
+*/
+
+int bin2scaled_longlong(const uchar *from, longlong *to, int precision,
+                        int scale) {
+  DBUG_ASSERT(precision <= DECIMAL_LONGLONG_PRECISION);
+  DBUG_ASSERT(scale <= precision);
+
+  int intg = precision - scale, intg0 = intg / DIG_PER_DEC1,
+      frac0 = scale / DIG_PER_DEC1, intg0x = intg - intg0 * DIG_PER_DEC1,
+      frac0x = scale - frac0 * DIG_PER_DEC1;
+  dec1 mask = (*from & 0x80) ? 0 : -1;
+  uchar d_copy[DECIMAL_LONGLONG_PRECISION / 2 + 1];
+  const int bin_size = decimal_bin_size_inline(precision, scale);
+  DBUG_ASSERT(bin_size <= static_cast<int>(sizeof(d_copy)));
+
+  memcpy(d_copy, from, bin_size);
+  d_copy[0] ^= 0x80;
+  from = d_copy;
+
+  longlong x = 0;
+  if (intg0x) {
+    dec1 y = read_bin_group(from, intg0x, mask);
+    if (((ulonglong)y) >= (ulonglong)powers10[intg0x + 1]) goto err;
+    x = y;
+    from += dig2bytes[intg0x];
+  }
+  for (int i = 0; i < intg0 + frac0; i++, from += sizeof(dec1)) {
+    dec1 y = mi_sint4korr(from) ^ mask;
+    if (((uint32)y) > DIG_MAX) goto err;
+    x = x * DIG_BASE + y;
+  }
+  if (frac0x) {
+    dec1 y = read_bin_group(from, frac0x, mask);
+    if (((uint32)y) >= (uint32)powers10[frac0x]) goto err;
+    x = x * powers10[frac0x] + y;
+  }
+
+  *to = mask ? -x : x;
+  return E_DEC_OK;
+
+err:
+  *to = 0;
+  return E_DEC_BAD_NUM;
+}
+
+/*
+  Convert an integer scaled by 10^scale to decimal
+
+  SYNOPSIS
+    scaled_longlong2decimal()
+      from    - value to convert, see bin2scaled_longlong()
+      scale   - number of decimal digits after the point, at most
+                DECIMAL_LONGLONG_PRECISION
+      to      - result
+
+  RETURN VALUE
+    E_DEC_OK/E_DEC_OVERFLOW
+*/
+
+int scaled_longlong2decimal(longlong from, int scale, decimal_t *to) {
+  DBUG_ASSERT(scale >= 0 && scale <= DECIMAL_LONGLONG_PRECISION);
+  sanity(to);
+
+  ulonglong x = from < 0 ? -static_cast<ulonglong>(from) : from;
+  ulonglong scale_factor = 1;
+  for (int i = 0; i < scale; i++) scale_factor *= 10;
+  ulonglong intg_part = x / scale_factor;
+  ulonglong frac_part = x - intg_part * scale_factor;
+
+  int intg1 = 1;
+  for (ulonglong y = intg_part / DIG_BASE; y != 0; y /= DIG_BASE) intg1++;
+  int frac1 = ROUND_UP(scale);
+  if (unlikely(intg1 + frac1 > to->len)) return E_DEC_OVERFLOW;
+
+  to->sign = from < 0;
+  to->intg = intg1 * DIG_PER_DEC1;
+  to->frac = scale;
+
+  for (dec1 *buf = to->buf + intg1; buf > to->buf;) {
+    ulonglong y = intg_part / DIG_BASE;
+    *--buf = (dec1)(intg_part - y * DIG_BASE);
+    intg_part = y;
+  }
+
+  /* Left align the fraction in its last dec1. */
+  for (int i = scale; i < frac1 * DIG_PER_DEC1; i++) frac_part *= 10;
+  for (dec1 *buf = to->buf + intg1 + frac1; buf > to->buf + intg1;) {
+    ulonglong y = frac_part / DIG_BASE;
+    *--buf = (dec1)(frac_part - y * DIG_BASE);
+    frac_part = y;
+  }
+  return E_DEC_OK;
+}
+
 /*
   Returns the size of array to hold a decimal with given precision and scale
 
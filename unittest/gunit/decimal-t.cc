@@ -101,6 +101,12 @@ void dump_decimal(decimal_t *d) {
     do_test_d2b2d(p1, p2, p3, p4, p5); \
   }
 
+#define test_d2b2sll2d(p1, p2, p3, p4, p5) \
+  {                                        \
+    SCOPED_TRACE("");                      \
+    do_test_d2b2sll2d(p1, p2, p3, p4, p5); \
+  }
+
 #define test_f2d(p1, p2) \
   {                      \
     SCOPED_TRACE("");    \
@@ -312,6 +318,28 @@ void do_test_d2b2d(const char *str, int p, int s, const char *orig, int ex) {
   print_decimal(&a, orig, res, ex, s2);
 }
 
+void do_test_d2b2sll2d(const char *str, int p, int s, longlong scaled,
+                       const char *orig) {
+  char s1[100];
+  uchar buf[100];
+
+  sprintf(s1, "'%s' {%2d, %2d}", str, p, s);
+  const char *end = strend(str);
+  string2decimal(str, &a, &end);
+  EXPECT_EQ(E_DEC_OK, decimal2bin(&a, buf, p, s)) << s1;
+
+  longlong x;
+  EXPECT_EQ(E_DEC_OK, bin2scaled_longlong(buf, &x, p, s)) << s1;
+  EXPECT_EQ(scaled, x) << s1;
+
+  int res = scaled_longlong2decimal(x, s, &b);
+  print_decimal(&b, orig, res, 0, s1);
+
+  // Must agree with the general path.
+  EXPECT_EQ(E_DEC_OK, bin2decimal(buf, &c, p, s)) << s1;
+  EXPECT_EQ(0, decimal_cmp(&b, &c)) << s1;
+}
+
 void do_test_f2d(double from, int ex) {
   int res;
   char s1[100];
@@ -725,6 +753,24 @@ TEST_F(DecimalTest, Decimal2BinBin2Decimal) {
   test_d2b2d("123.4", 10, 2, "123.40", 0);
 }
 
+TEST_F(DecimalTest, Decimal2BinBin2ScaledLonglong) {
+  test_d2b2sll2d("-10.55", 4, 2, -1055, "-10.55");
+  test_d2b2sll2d("12345", 5, 0, 12345, "12345");
+  test_d2b2sll2d("12345", 10, 3, 12345000, "12345.000");
+  test_d2b2sll2d("-123.45", 15, 2, -12345, "-123.45");
+  test_d2b2sll2d("0", 15, 2, 0, "0.00");
+  test_d2b2sll2d("-0.01", 15, 2, -1, "-0.01");
+  test_d2b2sll2d(".000123456789", 18, 12, 123456789, "0.000123456789");
+  test_d2b2sll2d("1234567890123.45678", 18, 5, 123456789012345678LL,
+                 "1234567890123.45678");
+  test_d2b2sll2d("999999999999999999", 18, 0, 999999999999999999LL,
+                 "999999999999999999");
+  test_d2b2sll2d("-999999999.999999999", 18, 9, -999999999999999999LL,
+                 "-999999999.999999999");
+  test_d2b2sll2d("0.999999999999999999", 18, 18, 999999999999999999LL,
+                 "0.999999999999999999");
+}
+
 TEST_F(DecimalTest, DecimalCmp) {
   test_dc("12", "13", -1);
   test_dc("13", "12", 1);
@@ -1040,6 +1086,39 @@ static void BM_Bin2Decimal_10_2(size_t iters) {
 }
 BENCHMARK(BM_Bin2Decimal_10_2)
 
+static void BM_Bin2ScaledLonglong_10_2(size_t iters) {
+  StopBenchmarkTiming();
+  constexpr size_t num_elements = array_elements(decimal_testdata);
+  constexpr int bin_size = 5;
+  ASSERT_EQ(bin_size, decimal_bin_size(10, 2)) << "Need to adjust bin_size";
+  uchar packed_buf[num_elements][bin_size];
+
+  decimal_t decimal;
+  decimal_digit_t decimal_buf[9];
+  decimal.buf = decimal_buf;
+  decimal.len = array_elements(decimal_buf);
+
+  for (size_t i = 0; i < num_elements; ++i) {
+    const char *end = strend(decimal_testdata[i]);
+    int res = string2decimal(decimal_testdata[i], &decimal, &end);
+    ASSERT_EQ(E_DEC_OK, res) << decimal_testdata[i] << " wasn't converted";
+    res = decimal2bin(&decimal, packed_buf[i], 10, 2);
+    ASSERT_EQ(E_DEC_OK, res)
+        << decimal_testdata[i] << " wasn't converted in stage 2";
+  }
+  StartBenchmarkTiming();
+
+  longlong sum = 0;
+  for (size_t i = 0; i < iters; ++i) {
+    longlong value;
+    bin2scaled_longlong(packed_buf[i % num_elements], &value, 10, 2);
+    sum += value;
+  }
+
+  ASSERT_NE(-1, sum);  // To keep the optimizer from removing the loop.
+}
+BENCHMARK(BM_Bin2ScaledLonglong_10_2)
+
 static void BM_Decimal2String(size_t iterations) {
   StopBenchmarkTiming();
   constexpr size_t num_elements = array_elements(decimal_testdata);
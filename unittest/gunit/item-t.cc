@@ -844,6 +844,57 @@ TEST_F(ItemTest, CompareEmptyStrings) {
   EXPECT_EQ(0, comparator.compare_binary_string());
 }
 
+TEST_F(ItemTest, CompareIntWithLiteral) {
+  Mock_field_long field(MY_INT32_NUM_DECIMAL_DIGITS);
+  Item *item1 = new Item_field(&field);
+  Item *item2 = new Item_int(10);
+  Item_result_field *owner = new Item_func_lt(item1, item2);
+  EXPECT_FALSE(item1->fix_fields(thd(), nullptr));
+  EXPECT_FALSE(item2->fix_fields(thd(), nullptr));
+
+  Arg_comparator comparator(&item1, &item2);
+  EXPECT_FALSE(comparator.set_cmp_func(owner, &item1, &item2, false));
+
+  int4store(field.ptr, 9);
+  EXPECT_EQ(-1, comparator.compare());
+  int4store(field.ptr, 10);
+  EXPECT_EQ(0, comparator.compare());
+  int4store(field.ptr, 11);
+  EXPECT_EQ(1, comparator.compare());
+
+  // The literal may be replaced after the comparator has been set up.
+  item2 = new Item_int(20);
+  EXPECT_FALSE(item2->fix_fields(thd(), nullptr));
+  EXPECT_EQ(-1, comparator.compare());
+}
+
+TEST_F(ItemTest, InLonglongHashLookup) {
+  MEM_ROOT *const mem_root = thd()->mem_root;
+  const uint count = 40;
+  Item *items[count];
+  for (uint i = 0; i < count - 2; i++) items[i] = new Item_int(3LL * i - 30);
+  // -1 as a signed value and ULLONG_MAX as an unsigned value.
+  items[count - 2] = new Item_int(-1LL);
+  items[count - 1] = new Item_uint(ULLONG_MAX);
+
+  in_longlong array(mem_root, count);
+  EXPECT_FALSE(array.fill(items, count));
+
+  for (longlong val = -40; val < 100; val++) {
+    Item_int probe(val);
+    const longlong last = 3LL * (count - 3) - 30;
+    const bool expected =
+        val == -1 || (val >= -30 && val <= last && val % 3 == 0);
+    EXPECT_EQ(expected, array.find_item(&probe)) << val;
+  }
+
+  // Same bits, but different signedness outside the common range.
+  Item_uint big(ULLONG_MAX);
+  EXPECT_TRUE(array.find_item(&big));
+  Item_uint other(ULLONG_MAX - 1);
+  EXPECT_FALSE(array.find_item(&other));
+}
+
 TEST_F(ItemTest, ItemJson) {
   MEM_ROOT *const mem_root = initializer.thd()->mem_root;
 
@@ -698,6 +698,40 @@ TEST(FieldJSONTest, TruncatedSortKey) {
   initializer.TearDown();
 }
 
+/**
+  Test JSON_EXTRACT with a path expression which is not constant, so
+  that the cached path must be refreshed when the path text changes.
+*/
+TEST_F(ItemJsonFuncTest, NonConstantPath) {
+  Base_mock_field_json doc_field;
+  Base_mock_field_json path_field;
+  Fake_TABLE table(&doc_field, &path_field);
+  doc_field.make_writable();
+  path_field.make_writable();
+  store_json(&doc_field, "{\"a\": 1, \"b\": 2}");
+
+  auto path = new Item_func_json_unquote(POS(), new Item_field(&path_field));
+  auto extract = new Item_func_json_extract(table.in_use, POS(),
+                                            new Item_field(&doc_field), path);
+  EXPECT_FALSE(extract->fix_fields(table.in_use, nullptr));
+  EXPECT_FALSE(extract->const_for_execution());
+
+  for (const char *path_text : {"\"$.a\"", "\"$.a\"", "\"$.b\"", "\"$.c\"",
+                                "\"$.a\"", "\"$.b\"", "\"$.b\""}) {
+    SCOPED_TRACE(path_text);
+    store_json(&path_field, path_text);
+    Json_wrapper res;
+    EXPECT_FALSE(extract->val_json(&res));
+    if (std::strcmp(path_text, "\"$.c\"") == 0) {
+      EXPECT_TRUE(extract->null_value);
+      continue;
+    }
+    EXPECT_FALSE(extract->null_value);
+    const longlong expected = path_text[3] == 'a' ? 1 : 2;
+    EXPECT_EQ(expected, res.get_int());
+  }
+}
+
 /**
   Microbenchmark which tests the performance of the JSON_SEARCH function.
 */
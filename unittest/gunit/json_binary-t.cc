@@ -313,6 +313,92 @@ TEST_F(JsonBinaryTest, EmptyDocument) {
   EXPECT_EQ(Value::LITERAL_NULL, val.type());
 }
 
+/**
+  Check that serializing a JSON text directly with serialize_text()
+  gives the same binary representation as parsing it into a DOM and
+  serializing the DOM.
+*/
+static void check_serialize_text(const THD *thd, const std::string &text) {
+  SCOPED_TRACE(text.substr(0, 100));
+  Json_dom_ptr dom = parse_json(text.c_str());
+  String expected;
+  EXPECT_FALSE(serialize(thd, dom.get(), &expected));
+
+  String actual;
+  const char *syntaxerr = nullptr;
+  EXPECT_FALSE(serialize_text(thd, text.data(), text.length(), &actual,
+                              &syntaxerr, nullptr));
+  EXPECT_TRUE(parse_binary(actual.ptr(), actual.length()).is_valid());
+  ASSERT_EQ(expected.length(), actual.length());
+  EXPECT_EQ(0, memcmp(expected.ptr(), actual.ptr(), actual.length()));
+}
+
+TEST_F(JsonBinaryTest, SerializeTextTest) {
+  for (const char *text :
+       {"null", "true", "false", "-123", "3.14", "18446744073709551615",
+        "\"abc\"", "[]", "{}", "[1, 2, 3]", "{\"b\": 1, \"a\": 2, \"aa\": 3}",
+        "[[], {}, [[]], {\"x\": {}}]",
+        "[32767, 32768, -32768, -32769, 65535, 65536, 2147483647, 2147483648,"
+        " -2147483648, -2147483649, 4294967295, 4294967296,"
+        " 9223372036854775807, 9223372036854775808]",
+        "{\"a\": {\"b\": [true, false, null, \"s\", 1.5e300]}, \"\": 0}",
+        // The last duplicate key wins.
+        "{\"dup\": {\"a\": 1}, \"x\": 1, \"dup\": [1, 2], \"dup\": \"last\"}"})
+    check_serialize_text(thd(), text);
+
+  // Documents which need the large storage format, at the top or nested.
+  std::string large_array = "[";
+  for (int i = 0; i < 20000; ++i) {
+    if (i > 0) large_array += ", ";
+    large_array += "true, -70000, \"a\"";
+  }
+  large_array += "]";
+  check_serialize_text(thd(), large_array);
+  check_serialize_text(thd(), "{\"small\": [1, 2], \"large\": " + large_array +
+                                  ", \"int32\": 100000}");
+
+  std::string wide_object = "{";
+  for (int i = 0; i < 5000; ++i) {
+    if (i > 0) wide_object += ", ";
+    wide_object += "\"key" + std::to_string(i) + "\": " + std::to_string(i);
+  }
+  wide_object += "}";
+  check_serialize_text(thd(), wide_object);
+
+  // Syntax errors are reported like in Json_dom::parse().
+  for (const char *text : {"[1, 2", "{\"a\" 1}", "[1e400]", ""}) {
+    SCOPED_TRACE(text);
+    const char *syntaxerr = nullptr;
+    size_t offset = 0;
+    String buf;
+    EXPECT_TRUE(
+        serialize_text(thd(), text, strlen(text), &buf, &syntaxerr, &offset));
+    EXPECT_NE(nullptr, syntaxerr);
+  }
+}
+
+TEST_F(JsonBinaryTest, SerializeTextMaxAllowedPacket) {
+  const ulong saved_max_allowed_packet = thd()->variables.max_allowed_packet;
+  thd()->variables.max_allowed_packet = 1024;
+
+  // A top-level scalar is checked as well as containers.
+  for (const std::string &text :
+       {"\"" + std::string(2000, 'a') + "\"",
+        "[\"" + std::string(2000, 'a') + "\"]"}) {
+    SCOPED_TRACE(text.substr(0, 10));
+    my_testing::Mock_error_handler handler(thd(),
+                                           ER_WARN_ALLOWED_PACKET_OVERFLOWED);
+    const char *syntaxerr = nullptr;
+    String buf;
+    EXPECT_TRUE(serialize_text(thd(), text.data(), text.length(), &buf,
+                               &syntaxerr, nullptr));
+    EXPECT_EQ(nullptr, syntaxerr);
+    EXPECT_EQ(1, handler.handle_called());
+  }
+
+  thd()->variables.max_allowed_packet = saved_max_allowed_packet;
+}
+
 static MYSQL_TIME create_time() {
   const char *tstr = "13:14:15.654321";
   MYSQL_TIME t;
@@ -1430,4 +1516,79 @@ static void BM_JsonBinarySerializeStringArray(size_t num_iterations) {
 }
 BENCHMARK(BM_JsonBinarySerializeStringArray)
 
+/**
+  A JSON text which resembles a typical document: an array of small
+  objects with nested objects, arrays, strings and numbers.
+*/
+static std::string realistic_document() {
+  std::string text = "[";
+  for (int i = 0; i < 200; ++i) {
+    if (i > 0) text += ", ";
+    const std::string id = std::to_string(i);
+    text += "{\"id\": " + id + ", \"name\": \"user" + id +
+            "\", \"email\": \"user" + id +
+            "@example.com\", \"tags\": [\"red\", \"green\", \"blue\"]"
+            ", \"score\": " +
+            std::to_string(i * 0.37) + ", \"active\": " +
+            (i % 2 == 0 ? "true" : "false") +
+            ", \"address\": {\"city\": \"Springfield\", \"zip\": " +
+            std::to_string(10000 + i) + "}}";
+  }
+  text += "]";
+  return text;
+}
+
+/**
+  Microbenchmark which tests the performance of storing a JSON text in
+  binary format by first parsing it into a DOM.
+*/
+static void BM_JsonBinaryParseAndSerializeDocument(size_t num_iterations) {
+  StopBenchmarkTiming();
+
+  const std::string text = realistic_document();
+  my_testing::Server_initializer initializer;
+  initializer.SetUp();
+  const THD *thd = initializer.thd();
+
+  StartBenchmarkTiming();
+
+  for (size_t i = 0; i < num_iterations; ++i) {
+    Json_dom_ptr dom =
+        Json_dom::parse(text.data(), text.length(), nullptr, nullptr);
+    String buf;
+    EXPECT_FALSE(json_binary::serialize(thd, dom.get(), &buf));
+  }
+
+  StopBenchmarkTiming();
+
+  initializer.TearDown();
+}
+BENCHMARK(BM_JsonBinaryParseAndSerializeDocument)
+
+/**
+  Microbenchmark which tests the performance of storing a JSON text in
+  binary format with json_binary::serialize_text(), without a DOM.
+*/
+static void BM_JsonBinarySerializeTextDocument(size_t num_iterations) {
+  StopBenchmarkTiming();
+
+  const std::string text = realistic_document();
+  my_testing::Server_initializer initializer;
+  initializer.SetUp();
+  const THD *thd = initializer.thd();
+
+  StartBenchmarkTiming();
+
+  for (size_t i = 0; i < num_iterations; ++i) {
+    String buf;
+    EXPECT_FALSE(json_binary::serialize_text(thd, text.data(), text.length(),
+                                             &buf, nullptr, nullptr));
+  }
+
+  StopBenchmarkTiming();
+
+  initializer.TearDown();
+}
+BENCHMARK(BM_JsonBinarySerializeTextDocument)
+
 }  // namespace json_binary_unittest
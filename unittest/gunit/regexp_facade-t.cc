@@ -124,4 +124,152 @@ TEST_F(RegexpFacadeTest, SetPattern) {
   regex.SetPattern(nullptr, 0);
 }
 
+/*
+  Plain literal patterns are matched without ICU when possible. The results
+  must be the same as ICU's, also when falling back to ICU.
+*/
+TEST_F(RegexpFacadeTest, LiteralPatterns) {
+  auto matches = [this](const char *pattern, const char *subject,
+                        uint32_t flags) {
+    Regexp_facade facade;
+    EXPECT_FALSE(facade.SetPattern(make_fixed_literal(thd(), pattern), flags));
+    auto result = facade.Matches(make_fixed_literal(thd(), subject), 1, 0);
+    EXPECT_TRUE(result.has_value());
+    return result.value();
+  };
+
+  EXPECT_TRUE(matches("abc", "xxabcxx", 0));
+  EXPECT_FALSE(matches("abc", "xxabxcx", 0));
+  EXPECT_FALSE(matches("abc", "xxABCxx", 0));
+  EXPECT_TRUE(matches("abc", "xxABCxx", UREGEX_CASE_INSENSITIVE));
+  EXPECT_FALSE(matches("a@c", "xxA`Cxx", UREGEX_CASE_INSENSITIVE));
+  EXPECT_TRUE(matches("^abc", "abcxx", 0));
+  EXPECT_FALSE(matches("^abc", "xabc", 0));
+  EXPECT_FALSE(matches("^abc", "x\nabc", 0));
+  EXPECT_TRUE(matches("^abc", "x\nabc", UREGEX_MULTILINE));
+  EXPECT_TRUE(matches(u8"\u00E6b", u8"x\u00E6by", 0));
+  EXPECT_FALSE(matches(u8"\u00E6b", u8"x\u00C6by", 0));
+
+  // These are left to ICU.
+  EXPECT_TRUE(matches("a.c", "xxabcxx", 0));
+  EXPECT_TRUE(matches(u8"\u00E6b", u8"x\u00C6by", UREGEX_CASE_INSENSITIVE));
+  EXPECT_TRUE(matches("k", u8"\u212A", UREGEX_CASE_INSENSITIVE));
+}
+
+/*
+  A pattern which is re-evaluated for every row, like a column reference.
+*/
+static Item *make_non_constant_literal(THD *thd, const char *pattern) {
+  auto item =
+      down_cast<Item_basic_constant *>(make_fixed_literal(thd, pattern));
+  item->set_used_tables(RAND_TABLE_BIT);
+  return item;
+}
+
+class CachingRegexpFacade : public Regexp_facade {
+ public:
+  explicit CachingRegexpFacade(THD *thd) : m_thd(thd) {}
+
+  const Regexp_engine *Compile(const char *pattern, uint32_t flags = 0) {
+    EXPECT_FALSE(SetPattern(make_non_constant_literal(m_thd, pattern), flags));
+    return m_engine.get();
+  }
+
+  bool MatchesValue(const char *subject) {
+    auto result = Matches(make_fixed_literal(m_thd, subject), 1, 0);
+    EXPECT_TRUE(result.has_value());
+    return result.value();
+  }
+
+  bool IsCached(const char *pattern, uint32_t flags = 0) const {
+    const std::u16string u16_pattern(pattern, pattern + strlen(pattern));
+    for (const auto &compiled : m_engine_cache)
+      if (compiled.pattern == u16_pattern && compiled.flags == flags)
+        return true;
+    return false;
+  }
+
+  size_t CacheSize() const { return m_engine_cache.size(); }
+
+  static constexpr size_t CacheCapacity() { return ENGINE_CACHE_SIZE; }
+
+ private:
+  THD *m_thd;
+};
+
+TEST_F(RegexpFacadeTest, EngineCacheAlternatingPatterns) {
+  CachingRegexpFacade facade(thd());
+
+  const Regexp_engine *ab = facade.Compile("a+b");
+  const Regexp_engine *cd = facade.Compile("c+d");
+  EXPECT_NE(ab, cd);
+  EXPECT_TRUE(facade.IsCached("a+b"));
+  EXPECT_FALSE(facade.MatchesValue("xaabx"));
+  EXPECT_TRUE(facade.MatchesValue("xccdx"));
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(ab, facade.Compile("a+b"));
+    EXPECT_TRUE(facade.MatchesValue("xaabx"));
+    EXPECT_FALSE(facade.MatchesValue("xccdx"));
+    EXPECT_EQ(cd, facade.Compile("c+d"));
+    EXPECT_FALSE(facade.MatchesValue("xaabx"));
+    EXPECT_TRUE(facade.MatchesValue("xccdx"));
+  }
+  EXPECT_EQ(1U, facade.CacheSize());
+}
+
+TEST_F(RegexpFacadeTest, EngineCacheFlags) {
+  CachingRegexpFacade facade(thd());
+
+  const Regexp_engine *sensitive = facade.Compile("a+b");
+  EXPECT_FALSE(facade.MatchesValue("xAABx"));
+
+  // Same pattern, different flags: must be compiled again.
+  const Regexp_engine *insensitive =
+      facade.Compile("a+b", UREGEX_CASE_INSENSITIVE);
+  EXPECT_NE(sensitive, insensitive);
+  EXPECT_TRUE(facade.MatchesValue("xAABx"));
+  EXPECT_TRUE(facade.IsCached("a+b"));
+  EXPECT_FALSE(facade.IsCached("a+b", UREGEX_CASE_INSENSITIVE));
+
+  // Both are now cached, each with its own flags.
+  EXPECT_EQ(sensitive, facade.Compile("a+b"));
+  EXPECT_FALSE(facade.MatchesValue("xAABx"));
+  EXPECT_EQ(insensitive, facade.Compile("a+b", UREGEX_CASE_INSENSITIVE));
+  EXPECT_TRUE(facade.MatchesValue("xAABx"));
+}
+
+TEST_F(RegexpFacadeTest, EngineCacheEviction) {
+  CachingRegexpFacade facade(thd());
+  const size_t capacity = CachingRegexpFacade::CacheCapacity();
+
+  // One more pattern than the cache and the current engine can hold.
+  std::vector<std::string> patterns;
+  std::vector<const Regexp_engine *> engines;
+  for (size_t i = 0; i < capacity + 2; ++i) {
+    patterns.push_back("x" + std::to_string(i) + "+");
+    engines.push_back(facade.Compile(patterns.back().c_str()));
+  }
+  EXPECT_EQ(capacity, facade.CacheSize());
+  EXPECT_FALSE(facade.IsCached(patterns[0].c_str()));
+  for (size_t i = 1; i <= capacity; ++i)
+    EXPECT_TRUE(facade.IsCached(patterns[i].c_str())) << patterns[i];
+
+  // The least recently used pattern is still served from the cache.
+  EXPECT_EQ(engines[1], facade.Compile(patterns[1].c_str()));
+  EXPECT_TRUE(facade.MatchesValue("ax11b"));
+  EXPECT_EQ(capacity, facade.CacheSize());
+  EXPECT_TRUE(facade.IsCached(patterns[2].c_str()));
+  EXPECT_TRUE(facade.IsCached(patterns[capacity + 1].c_str()));
+
+  // The evicted pattern is compiled again, evicting the next oldest one.
+  facade.Compile(patterns[0].c_str());
+  EXPECT_TRUE(facade.MatchesValue("ax00b"));
+  EXPECT_FALSE(facade.MatchesValue("ax11b"));
+  EXPECT_EQ(capacity, facade.CacheSize());
+  EXPECT_FALSE(facade.IsCached(patterns[2].c_str()));
+  EXPECT_TRUE(facade.IsCached(patterns[1].c_str()));
+  EXPECT_TRUE(facade.IsCached(patterns[capacity + 1].c_str()));
+}
+
 }  // namespace regexp_facade_unittest
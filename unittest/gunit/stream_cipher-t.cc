@@ -571,4 +571,33 @@ TEST(Aes_ctr, MaxSeekAndEncryptAndDecrypt) {
   SeekAndEncryptAndDecrypt<Aes_ctr>(max);
 }
 
+/*
+  A cipher that is reopened with another password must not keep using the
+  key of the first one.
+*/
+TEST(Aes_ctr, ReopenWithOtherPassword) {
+  const int stream_size = 100;
+  unsigned char source[stream_size];
+  unsigned char reopened[stream_size];
+  unsigned char fresh[stream_size];
+  my_rand_buffer(source, stream_size);
+
+  Key_string first_key(reinterpret_cast<const unsigned char *>("first"), 5);
+  Key_string second_key(reinterpret_cast<const unsigned char *>("second"), 6);
+
+  std::unique_ptr<Stream_cipher> encryptor = Aes_ctr::get_encryptor();
+  EXPECT_FALSE(encryptor->open(first_key, 0));
+  EXPECT_FALSE(encryptor->encrypt(reopened, source, stream_size));
+  EXPECT_FALSE(encryptor->open(second_key, 0));
+  EXPECT_FALSE(encryptor->set_stream_offset(10));
+  EXPECT_FALSE(encryptor->set_stream_offset(0));
+  EXPECT_FALSE(encryptor->encrypt(reopened, source, stream_size));
+
+  std::unique_ptr<Stream_cipher> fresh_encryptor = Aes_ctr::get_encryptor();
+  EXPECT_FALSE(fresh_encryptor->open(second_key, 0));
+  EXPECT_FALSE(fresh_encryptor->encrypt(fresh, source, stream_size));
+
+  EXPECT_EQ(0, memcmp(reopened, fresh, stream_size));
+}
+
 }  // namespace stream_cipher_unittest
@@ -136,6 +136,14 @@ int compare_through_strxfrm(CHARSET_INFO *cs, const char *a, const char *b) {
   }
 }
 
+int sign(int val) { return (val < 0) ? -1 : ((val > 0) ? 1 : 0); }
+
+int compare_through_strnncoll(CHARSET_INFO *cs, const char *a, const char *b) {
+  return sign(cs->coll->strnncoll(cs, pointer_cast<const uchar *>(a), strlen(a),
+                                  pointer_cast<const uchar *>(b), strlen(b),
+                                  false));
+}
+
 }  // namespace
 
 #if !defined(DBUG_OFF)
@@ -1519,6 +1527,42 @@ static void BM_HashSimpleUTF8MB4(size_t num_iterations) {
 }
 BENCHMARK(BM_HashSimpleUTF8MB4)
 
+/*
+  Comparing two long ASCII strings that only differ at the very end,
+  like keys sharing a common prefix in an index.
+*/
+static void BM_StrnncollSimpleUTF8MB4(size_t num_iterations) {
+  StopBenchmarkTiming();
+
+  CHARSET_INFO *cs = init_collation("utf8mb4_0900_ai_ci");
+
+  const char *a =
+      "This is a rather long string that contains only "
+      "simple letters that are available in ASCII. This is a common special "
+      "case that warrants a benchmark on its own, even if the character set "
+      "and collation supports much more complicated scenarios.";
+  const char *b =
+      "This is a rather long string that contains only "
+      "simple letters that are available in ASCII. This is a common special "
+      "case that warrants a benchmark on its own, even if the character set "
+      "and collation supports much more complicated scenarios!";
+  const size_t alen = strlen(a);
+  const size_t blen = strlen(b);
+
+  int cmp = 0;
+  StartBenchmarkTiming();
+  for (size_t i = 0; i < num_iterations; ++i) {
+    cmp += sign(cs->coll->strnncoll(cs, pointer_cast<const uchar *>(a), alen,
+                                    pointer_cast<const uchar *>(b), blen,
+                                    false));
+  }
+  StopBenchmarkTiming();
+
+  EXPECT_EQ(static_cast<int>(num_iterations), cmp);
+  SetBytesProcessed(num_iterations * alen);
+}
+BENCHMARK(BM_StrnncollSimpleUTF8MB4)
+
 /*
   Test a non-trivial collation with contractions, to highlight
   the performance difference.
@@ -2265,6 +2309,65 @@ TEST(BitfiddlingTest, FastOutOfRange16) {
   }
 }
 
+/*
+  A version of FastOutOfRange for the 64-bit words used by the 16-byte
+  fast path. Exhaustive testing is out of the question, so test every byte
+  value in every position, surrounded by bytes that are in range (which is
+  where carries and borrows could otherwise hide an out-of-range byte).
+*/
+TEST(BitfiddlingTest, FastOutOfRange64) {
+  const unsigned char fillers[] = {0x20, 0x41, 0x7e};
+  for (unsigned char filler : fillers) {
+    for (int pos = 0; pos < 8; ++pos) {
+      for (int a = 0; a < 256; ++a) {
+        unsigned char bytes[8];
+        memset(bytes, filler, sizeof(bytes));
+        bytes[pos] = a;
+        bool any_out_of_range_slow = (a < 0x20 || a > 0x7e);
+
+        uint64 eight_bytes;
+        memcpy(&eight_bytes, bytes, sizeof(eight_bytes));
+        bool any_out_of_range_fast =
+            ((eight_bytes + 0x0101010101010101ULL) |
+             (eight_bytes - 0x2020202020202020ULL)) &
+            0x8080808080808080ULL;
+
+        EXPECT_EQ(any_out_of_range_slow, any_out_of_range_fast);
+      }
+    }
+  }
+}
+
+/*
+  strnncoll() skips any common prefix of printable ASCII before it starts
+  comparing weights. Verify that it still agrees with strnxfrm() when the
+  strings differ right after such a prefix, on every level.
+*/
+TEST(StrnncollTest, CommonAsciiPrefix) {
+  const char *collations[] = {"utf8mb4_0900_ai_ci", "utf8mb4_0900_as_ci",
+                              "utf8mb4_0900_as_cs"};
+  const char *prefixes[] = {"", "a", "abc", "The quick brown ",
+                            "The quick brown fox jumps over "};
+  const char *suffixes[] = {"",          " ",         "a",         "A",
+                            "b",         "\t",        "\n",        "ss",
+                            u8"\u00E1",  u8"\u00DF",  u8"a\u0301", "ab   ",
+                            "abc~",      u8"\u20AC"};
+  for (const char *collation : collations) {
+    CHARSET_INFO *cs = init_collation(collation);
+    for (const char *prefix : prefixes) {
+      for (const char *suffix1 : suffixes) {
+        for (const char *suffix2 : suffixes) {
+          const string a = string(prefix) + suffix1;
+          const string b = string(prefix) + suffix2;
+          SCOPED_TRACE(string(collation) + ": '" + a + "' vs. '" + b + "'");
+          EXPECT_EQ(sign(compare_through_strxfrm(cs, a.c_str(), b.c_str())),
+                    compare_through_strnncoll(cs, a.c_str(), b.c_str()));
+        }
+      }
+    }
+  }
+}
+
 uint64 hash(CHARSET_INFO *cs, const char *str) {
   uint64 nr1 = 1, nr2 = 4;
   cs->coll->hash_sort(cs, pointer_cast<const uchar *>(str), strlen(str), &nr1,
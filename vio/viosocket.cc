@@ -1159,8 +1159,7 @@ bool vio_is_connected(Vio *vio) {
   }
 
   /* There might be buffered data at the SSL layer. */
-  if (!bytes && vio->type == VIO_TYPE_SSL)
-    bytes = SSL_pending((SSL *)vio->ssl_arg);
+  if (!bytes && vio->type == VIO_TYPE_SSL) bytes = vio_ssl_has_data(vio);
 
   return bytes ? true : false;
 }
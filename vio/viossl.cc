@@ -718,6 +718,13 @@ int sslaccept(struct st_VioSSLFd *ptr, Vio *vio, long timeout,
               unsigned long *ssl_errno_holder) {
   DBUG_TRACE;
   int ret = ssl_do(ptr, vio, timeout, SSL_accept, ssl_errno_holder, nullptr);
+  /*
+    Let OpenSSL read as much as the socket has available into its record
+    buffer instead of issuing one recv() for each record header and body.
+    Only done for connections accepted by the server: clients, such as
+    libmysqlclient, keep reading one record at a time.
+  */
+  if (ret == 0) vio_ssl_set_read_ahead(vio, true);
   return ret;
 }
 
@@ -728,6 +735,21 @@ int sslconnect(struct st_VioSSLFd *ptr, Vio *vio, long timeout,
   return ret;
 }
 
+void vio_ssl_set_read_ahead(Vio *vio MY_ATTRIBUTE((unused)),
+                            bool read_ahead MY_ATTRIBUTE((unused))) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+  SSL_set_read_ahead(static_cast<SSL *>(vio->ssl_arg), read_ahead ? 1 : 0);
+#endif
+}
+
 bool vio_ssl_has_data(Vio *vio) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+  /*
+    Also counts bytes read ahead from the socket but not yet decrypted.
+    They may be only part of a record, so reading can still block.
+  */
+  return SSL_has_pending(static_cast<SSL *>(vio->ssl_arg)) ? true : false;
+#else
   return SSL_pending(static_cast<SSL *>(vio->ssl_arg)) > 0 ? true : false;
+#endif
 }